@@ -0,0 +1,152 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/background_block_indexer.hpp"
+
+#include <soci/soci.h>
+#include "ametsuchi/block_storage.hpp"
+#include "ametsuchi/impl/indexed_height.hpp"
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    constexpr std::chrono::seconds BackgroundBlockIndexer::kRetryDelay;
+
+    BackgroundBlockIndexer::BackgroundBlockIndexer(
+        std::unique_ptr<soci::session> sql,
+        std::shared_ptr<BlockStorage> block_store,
+        std::shared_ptr<IndexedHeight> indexed_height,
+        rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
+            committed_blocks,
+        HeightType committed_height,
+        logger::LoggerPtr log)
+        : sql_(std::move(sql)),
+          block_store_(std::move(block_store)),
+          indexed_height_(std::move(indexed_height)),
+          log_(std::move(log)),
+          committed_height_(committed_height) {
+      const auto indexed = getIndexedHeight(*sql_);
+      indexed_height_->indexed(indexed);
+      indexed_height_->committed(committed_height);
+      log_->info("Transaction positions are indexed up to height {} of {}",
+                 indexed,
+                 committed_height);
+
+      committed_blocks.subscribe(subscription_, [this](const auto &block) {
+        indexed_height_->committed(block->height());
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          committed_height_ = block->height();
+        }
+        committed_cv_.notify_one();
+      });
+      thread_ = std::thread([this] { run(); });
+    }
+
+    BackgroundBlockIndexer::~BackgroundBlockIndexer() {
+      subscription_.unsubscribe();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_ = true;
+      }
+      committed_cv_.notify_one();
+      thread_.join();
+    }
+
+    void BackgroundBlockIndexer::run() {
+      auto height = indexed_height_->getIndexed();
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (not stop_requested_) {
+        if (height >= committed_height_) {
+          committed_cv_.wait(lock, [&] {
+            return stop_requested_ or height < committed_height_;
+          });
+          continue;
+        }
+
+        lock.unlock();
+        bool indexed = index(*sql_, *block_store_, height + 1, log_);
+        lock.lock();
+        if (indexed) {
+          indexed_height_->indexed(++height);
+        } else {
+          committed_cv_.wait_for(
+              lock, kRetryDelay, [this] { return stop_requested_; });
+        }
+      }
+    }
+
+    bool BackgroundBlockIndexer::indexMissing(soci::session &sql,
+                                              BlockStorage &block_store,
+                                              HeightType committed_height,
+                                              const logger::LoggerPtr &log) {
+      const auto indexed = getIndexedHeight(sql);
+      if (indexed >= committed_height) {
+        return true;
+      }
+      log->info("Indexing transaction positions of blocks {} to {}",
+                indexed + 1,
+                committed_height);
+      for (auto height = indexed + 1; height <= committed_height; ++height) {
+        if (not index(sql, block_store, height, log)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    BackgroundBlockIndexer::HeightType
+    BackgroundBlockIndexer::getIndexedHeight(soci::session &sql) {
+      // indexes of a block are written in a single transaction, and every
+      // block with transactions has a position of its creator, so the
+      // indexes are complete up to the top indexed height. Later blocks
+      // without transactions are indexed again, which changes nothing
+      HeightType indexed = 0;
+      sql << "SELECT COALESCE(MAX(height), 0) FROM tx_positions",
+          soci::into(indexed);
+      return indexed;
+    }
+
+    bool BackgroundBlockIndexer::index(soci::session &sql,
+                                       BlockStorage &block_store,
+                                       HeightType height,
+                                       const logger::LoggerPtr &log) {
+      auto block = block_store.fetch(height);
+      if (not block) {
+        log->error("Block {} to index is not in the block storage", height);
+        return false;
+      }
+
+      try {
+        sql << "BEGIN";
+        PostgresBlockIndex block_index(
+            std::make_unique<PostgresIndexer>(sql),
+            log,
+            PostgresBlockIndex::Tables::kTxPositions);
+        if (auto e = expected::resultToOptionalError(
+                block_index.tryIndex(**block))) {
+          log->error("Failed to index block {}: {}", height, e.value());
+          sql << "ROLLBACK";
+          return false;
+        }
+        sql << "COMMIT";
+      } catch (const std::exception &e) {
+        log->error("Failed to index block {}: {}", height, e.what());
+        try {
+          sql << "ROLLBACK";
+        } catch (const std::exception &) {
+          // the connection is broken, the next attempt reports it
+        }
+        return false;
+      }
+      return true;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
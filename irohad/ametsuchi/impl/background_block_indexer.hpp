@@ -0,0 +1,115 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BACKGROUND_BLOCK_INDEXER_HPP
+#define IROHA_BACKGROUND_BLOCK_INDEXER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <rxcpp/rx-lite.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class BlockStorage;
+    class IndexedHeight;
+
+    /**
+     * Writes transaction positions of committed blocks on its own connection
+     * and thread, so that the commit does not wait for them. Blocks are taken
+     * from the block storage in the order of heights, starting after the
+     * last indexed one, and the indexes of each block are written in a
+     * separate transaction. The progress is reported to IndexedHeight.
+     */
+    class BackgroundBlockIndexer {
+     public:
+      using HeightType = shared_model::interface::types::HeightType;
+
+      /// delay before indexing is retried after a failure
+      static constexpr std::chrono::seconds kRetryDelay{1};
+
+      /**
+       * @param sql - session used only by the indexer
+       * @param block_store - storage of committed blocks
+       * @param indexed_height - watermark updated by the indexer
+       * @param committed_blocks - blocks, indexes of which are to be written
+       * @param committed_height - height of the top committed block
+       * @param log - logger
+       */
+      BackgroundBlockIndexer(
+          std::unique_ptr<soci::session> sql,
+          std::shared_ptr<BlockStorage> block_store,
+          std::shared_ptr<IndexedHeight> indexed_height,
+          rxcpp::observable<
+              std::shared_ptr<const shared_model::interface::Block>>
+              committed_blocks,
+          HeightType committed_height,
+          logger::LoggerPtr log);
+
+      ~BackgroundBlockIndexer();
+
+      /**
+       * Write the transaction positions which are missing up to the committed
+       * height on the calling thread. Used on start without background
+       * indexing, so that the blocks left unindexed by a previous run with it
+       * do not stay a gap below the positions written by the commits
+       * @param sql - session to write the indexes with
+       * @param block_store - storage of committed blocks
+       * @param committed_height - height of the top committed block
+       * @param log - logger
+       * @return true if all committed blocks are indexed
+       */
+      static bool indexMissing(soci::session &sql,
+                               BlockStorage &block_store,
+                               HeightType committed_height,
+                               const logger::LoggerPtr &log);
+
+     private:
+      void run();
+
+      /// @return height up to which the transaction positions are written
+      static HeightType getIndexedHeight(soci::session &sql);
+
+      /// Write indexes of the block at the height
+      /// @return true if the indexes are written
+      static bool index(soci::session &sql,
+                        BlockStorage &block_store,
+                        HeightType height,
+                        const logger::LoggerPtr &log);
+
+      std::unique_ptr<soci::session> sql_;
+      std::shared_ptr<BlockStorage> block_store_;
+      std::shared_ptr<IndexedHeight> indexed_height_;
+      logger::LoggerPtr log_;
+
+      std::mutex mutex_;
+      std::condition_variable committed_cv_;
+      HeightType committed_height_;
+      bool stop_requested_ = false;
+
+      rxcpp::composite_subscription subscription_;
+      std::thread thread_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BACKGROUND_BLOCK_INDEXER_HPP
@@ -0,0 +1,335 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/flat_file/block_compressor.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <ciso646>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include <zlib.h>
+#include <boost/filesystem.hpp>
+#include "common/files.hpp"
+#include "common/result.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  constexpr size_t kVersionDigits = 8;
+
+  std::string versionToName(uint32_t version) {
+    std::ostringstream os;
+    os << std::setw(kVersionDigits) << std::setfill('0') << version;
+    return os.str();
+  }
+
+  boost::optional<uint32_t> nameToVersion(const std::string &name) {
+    if (name.size() != kVersionDigits
+        or not std::all_of(name.begin(), name.end(), [](unsigned char c) {
+             return std::isdigit(c);
+           })) {
+      return boost::none;
+    }
+    return static_cast<uint32_t>(std::stoul(name));
+  }
+
+  uint32_t checksum(const std::string &data) {
+    return adler32(adler32(0L, Z_NULL, 0),
+                   reinterpret_cast<const Bytef *>(data.data()),
+                   data.size());
+  }
+
+  /// @return the error of the last system call on the given path
+  std::string systemError(const std::string &call,
+                          const boost::filesystem::path &path) {
+    return call + " of " + path.string() + " failed: " + std::strerror(errno);
+  }
+
+  /// Flush the data of an open file to the disk and close the file
+  iroha::expected::Result<void, std::string> syncAndClose(
+      int fd, const boost::filesystem::path &path) {
+    if (::fsync(fd) != 0) {
+      auto error = systemError("fsync", path);
+      ::close(fd);
+      return iroha::expected::makeError(std::move(error));
+    }
+    if (::close(fd) != 0) {
+      return iroha::expected::makeError(systemError("close", path));
+    }
+    return iroha::expected::Value<void>{};
+  }
+
+  /**
+   * Write the file and flush it and its directory entry to the disk, so that
+   * the file survives a crash of the machine
+   */
+  iroha::expected::Result<void, std::string> writeDurably(
+      const boost::filesystem::path &path, const std::string &data) {
+    const int fd =
+        ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd == -1) {
+      return iroha::expected::makeError(systemError("open", path));
+    }
+    size_t written = 0;
+    while (written < data.size()) {
+      auto result =
+          ::write(fd, data.data() + written, data.size() - written);
+      if (result == -1 and errno == EINTR) {
+        continue;
+      }
+      if (result == -1) {
+        auto error = systemError("write", path);
+        ::close(fd);
+        return iroha::expected::makeError(std::move(error));
+      }
+      written += result;
+    }
+    return syncAndClose(fd, path) |
+               [&path]() -> iroha::expected::Result<void, std::string> {
+      const auto dir = path.parent_path();
+      const int dir_fd =
+          ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+      if (dir_fd == -1) {
+        return iroha::expected::makeError(systemError("open", dir));
+      }
+      return syncAndClose(dir_fd, dir);
+    };
+  }
+}  // namespace
+
+boost::optional<std::unique_ptr<BlockCompressor>> BlockCompressor::create(
+    const std::string &path, bool compress_blocks, logger::LoggerPtr log) {
+  boost::system::error_code err;
+  if (not boost::filesystem::is_directory(path, err)
+      and not boost::filesystem::create_directories(path, err)) {
+    log->error("Cannot create dictionaries dir: {}\n{}", path, err.message());
+    return boost::none;
+  }
+
+  std::vector<std::shared_ptr<const Dictionary>> dictionaries;
+  for (auto it = boost::filesystem::directory_iterator{path};
+       it != boost::filesystem::directory_iterator{};
+       ++it) {
+    auto version = nameToVersion(it->path().filename().string());
+    if (not version) {
+      continue;
+    }
+    auto bytes = iroha::expected::resultToOptionalValue(
+        iroha::readBinaryFile(it->path().string()));
+    if (not bytes) {
+      log->error("Cannot read dictionary {}", it->path().string());
+      return boost::none;
+    }
+    std::string data(bytes->begin(), bytes->end());
+    auto id = checksum(data);
+    dictionaries.push_back(std::make_shared<const Dictionary>(
+        Dictionary{*version, id, std::move(data)}));
+  }
+  std::sort(dictionaries.begin(),
+            dictionaries.end(),
+            [](const auto &lhs, const auto &rhs) {
+              return lhs->version < rhs->version;
+            });
+
+  // Operator new is employed due to private visibility of used constructor.
+  return std::unique_ptr<BlockCompressor>(new BlockCompressor(
+      path, compress_blocks, std::move(dictionaries), std::move(log)));
+}
+
+BlockCompressor::BlockCompressor(
+    std::string path,
+    bool compress_blocks,
+    std::vector<std::shared_ptr<const Dictionary>> dictionaries,
+    logger::LoggerPtr log)
+    : path_(std::move(path)),
+      compress_blocks_(compress_blocks),
+      log_(std::move(log)) {
+  for (auto &dictionary : dictionaries) {
+    current_ = dictionary;
+    dictionaries_[dictionary->id] = std::move(dictionary);
+  }
+}
+
+BlockCompressor::Bytes BlockCompressor::compress(const Bytes &block) {
+  if (not compress_blocks_) {
+    return block;
+  }
+
+  std::shared_ptr<const Dictionary> dictionary;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    dictionary = current_;
+  }
+
+  z_stream stream{};
+  if (deflateInit(&stream, Z_DEFAULT_COMPRESSION) != Z_OK) {
+    log_->error("Cannot initialize deflate: {}", stream.msg);
+    return block;
+  }
+  if (dictionary) {
+    deflateSetDictionary(
+        &stream,
+        reinterpret_cast<const Bytef *>(dictionary->data.data()),
+        dictionary->data.size());
+  }
+
+  Bytes compressed(deflateBound(&stream, block.size()));
+  stream.next_in = const_cast<Bytef *>(block.data());
+  stream.avail_in = block.size();
+  stream.next_out = compressed.data();
+  stream.avail_out = compressed.size();
+  auto result = deflate(&stream, Z_FINISH);
+  compressed.resize(stream.total_out);
+  deflateEnd(&stream);
+
+  if (result != Z_STREAM_END) {
+    log_->error("Block compression failed with code {}", result);
+    return block;
+  }
+
+  sample(block);
+  return compressed;
+}
+
+boost::optional<BlockCompressor::Bytes> BlockCompressor::decompress(
+    const Bytes &data) const {
+  z_stream stream{};
+  if (inflateInit(&stream) != Z_OK) {
+    log_->error("Cannot initialize inflate: {}", stream.msg);
+    return boost::none;
+  }
+
+  Bytes block;
+  stream.next_in = const_cast<Bytef *>(data.data());
+  stream.avail_in = data.size();
+
+  int result = Z_OK;
+  while (result == Z_OK or result == Z_NEED_DICT or result == Z_BUF_ERROR) {
+    if (stream.avail_out == 0) {
+      auto written = stream.total_out;
+      // compression ratio of serialized blocks is usually well above 2
+      block.resize(std::max(block.size() * 2, data.size() * 4));
+      stream.next_out = block.data() + written;
+      stream.avail_out = block.size() - written;
+    }
+    result = inflate(&stream, Z_NO_FLUSH);
+    if (result == Z_NEED_DICT) {
+      std::shared_ptr<const Dictionary> dictionary;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = dictionaries_.find(stream.adler);
+        if (it != dictionaries_.end()) {
+          dictionary = it->second;
+        }
+      }
+      if (not dictionary) {
+        log_->error("Unknown compression dictionary {}", stream.adler);
+        break;
+      }
+      result = inflateSetDictionary(
+          &stream,
+          reinterpret_cast<const Bytef *>(dictionary->data.data()),
+          dictionary->data.size());
+    } else if (result == Z_BUF_ERROR and stream.avail_out != 0) {
+      // no progress is possible with the output space available
+      break;
+    }
+  }
+  block.resize(stream.total_out);
+  inflateEnd(&stream);
+
+  if (result != Z_STREAM_END) {
+    log_->error("Block decompression failed with code {}", result);
+    return boost::none;
+  }
+  return block;
+}
+
+bool BlockCompressor::isCompressed(const Bytes &data) {
+  // zlib header: deflate method in the low bits of the first byte and the
+  // header checksum making both bytes a multiple of 31
+  return data.size() >= 2 and (data[0] & 0x0f) == Z_DEFLATED
+      and ((data[0] << 8) | data[1]) % 31 == 0;
+}
+
+void BlockCompressor::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  iroha::remove_dir_contents(path_, log_);
+  dictionaries_.clear();
+  current_.reset();
+  samples_.clear();
+  blocks_since_training_ = 0;
+}
+
+size_t BlockCompressor::dictionarySize() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return current_ ? current_->data.size() : 0;
+}
+
+void BlockCompressor::sample(const Bytes &block) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const size_t period = current_ ? kRetrainPeriod : kTrainingBlocks;
+  ++blocks_since_training_;
+  // only the blocks right before the training are kept
+  if (blocks_since_training_ + kTrainingBlocks > period) {
+    samples_.push_back(block);
+  }
+  if (blocks_since_training_ >= period) {
+    train();
+    samples_.clear();
+    blocks_since_training_ = 0;
+  }
+}
+
+void BlockCompressor::train() {
+  // deflate prefers the most useful strings at the end of the dictionary, so
+  // the newest blocks go last
+  const size_t chunk_size = kMaxDictionarySize / samples_.size();
+  std::string data;
+  data.reserve(kMaxDictionarySize);
+  for (const auto &sample : samples_) {
+    data.append(sample.begin(),
+                sample.begin() + std::min(chunk_size, sample.size()));
+  }
+
+  // compressed blocks reference their dictionary only by the checksum, so a
+  // dictionary with the checksum of an older one is not used
+  const auto id = checksum(data);
+  if (dictionaries_.count(id) != 0) {
+    log_->warn("Compression dictionary checksum {} is already in use, "
+               "keeping dictionary version {}",
+               id,
+               current_ ? current_->version : 0);
+    return;
+  }
+
+  // the dictionary is on the disk before any block compressed with it
+  const uint32_t version = current_ ? current_->version + 1 : 1;
+  const auto file_name =
+      boost::filesystem::path{path_} / versionToName(version);
+  boost::system::error_code err;
+  boost::filesystem::create_directories(path_, err);
+  if (auto error = iroha::expected::resultToOptionalError(
+          writeDurably(file_name, data))) {
+    log_->error("Cannot write dictionary: {}", *error);
+    boost::filesystem::remove(file_name, err);
+    return;
+  }
+
+  auto dictionary = std::make_shared<const Dictionary>(
+      Dictionary{version, id, std::move(data)});
+  log_->info("Built compression dictionary version {} of {} bytes",
+             version,
+             dictionary->data.size());
+  dictionaries_[dictionary->id] = dictionary;
+  current_ = std::move(dictionary);
+}
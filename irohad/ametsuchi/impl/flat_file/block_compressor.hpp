@@ -0,0 +1,114 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_COMPRESSOR_HPP
+#define IROHA_BLOCK_COMPRESSOR_HPP
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Compresses serialized blocks with deflate using a preset dictionary.
+     * The dictionary is built from recently compressed blocks and is stored
+     * in a directory next to the blocks under increasing version numbers.
+     * Every compressed block references its dictionary by the checksum
+     * recorded in the deflate stream, so blocks compressed with older
+     * dictionaries stay readable. Thread safe.
+     */
+    class BlockCompressor {
+     public:
+      using Bytes = std::vector<uint8_t>;
+
+      /// Maximum size of a dictionary supported by deflate
+      static constexpr size_t kMaxDictionarySize = 32 * 1024;
+
+      /// Number of recent blocks a dictionary is built from
+      static constexpr size_t kTrainingBlocks = 64;
+
+      /// Number of blocks compressed with a dictionary before it is rebuilt
+      static constexpr size_t kRetrainPeriod = 10000;
+
+      /**
+       * Load the dictionaries from the given directory, creating it if needed
+       * @param path - directory of the dictionaries
+       * @param compress_blocks - whether compress() should compress. If not,
+       * the compressor is only used to read previously compressed blocks
+       * @param log - logger
+       * @return the compressor or boost::none if the directory is unusable
+       */
+      static boost::optional<std::unique_ptr<BlockCompressor>> create(
+          const std::string &path, bool compress_blocks, logger::LoggerPtr log);
+
+      /**
+       * Compress the serialized block and use it for building the next
+       * dictionary. The block is returned unchanged if compression is off
+       */
+      Bytes compress(const Bytes &block);
+
+      /**
+       * Restore the block serialized by compress()
+       * @return the block or boost::none if the data is corrupted or its
+       * dictionary is unknown
+       */
+      boost::optional<Bytes> decompress(const Bytes &data) const;
+
+      /// Whether the data looks like the output of deflate
+      static bool isCompressed(const Bytes &data);
+
+      /// Drop all the dictionaries
+      void clear();
+
+      /// @return the size of the current dictionary, 0 if there is none yet
+      size_t dictionarySize() const;
+
+     private:
+      struct Dictionary {
+        uint32_t version;
+        uint32_t id;
+        std::string data;
+      };
+
+      /// @param dictionaries - loaded dictionaries ordered by version
+      BlockCompressor(
+          std::string path,
+          bool compress_blocks,
+          std::vector<std::shared_ptr<const Dictionary>> dictionaries,
+          logger::LoggerPtr log);
+
+      /// Collect the block for training and rebuild the dictionary if due
+      void sample(const Bytes &block);
+
+      /// Build a dictionary from the collected blocks and save it
+      void train();
+
+      const std::string path_;
+      const bool compress_blocks_;
+
+      mutable std::mutex mutex_;
+      /// dictionaries by their checksum
+      std::unordered_map<uint32_t, std::shared_ptr<const Dictionary>>
+          dictionaries_;
+      std::shared_ptr<const Dictionary> current_;
+      std::deque<Bytes> samples_;
+      size_t blocks_since_training_ = 0;
+
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_COMPRESSOR_HPP
@@ -54,6 +54,10 @@ boost::optional<std::unique_ptr<FlatFile>> FlatFile::create(
   for (auto it = boost::filesystem::directory_iterator{path};
        it != boost::filesystem::directory_iterator{};
        ++it) {
+    if (boost::filesystem::is_directory(it->path())) {
+      // nested directories belong to the users of the storage
+      continue;
+    }
     if (auto id = FlatFile::name_to_id(it->path().filename().string())) {
       files_found.insert(*id);
     } else {
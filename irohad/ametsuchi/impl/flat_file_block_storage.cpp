@@ -13,20 +13,27 @@
 
 using namespace iroha::ametsuchi;
 
+const std::string FlatFileBlockStorage::kDictionariesDir = "dictionaries";
+
 FlatFileBlockStorage::FlatFileBlockStorage(
     std::unique_ptr<FlatFile> flat_file,
     std::shared_ptr<shared_model::interface::BlockJsonConverter> json_converter,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<BlockCompressor> compressor)
     : flat_file_storage_(std::move(flat_file)),
       json_converter_(std::move(json_converter)),
+      compressor_(std::move(compressor)),
       log_(std::move(log)) {}
 
 bool FlatFileBlockStorage::insert(
     std::shared_ptr<const shared_model::interface::Block> block) {
   return json_converter_->serialize(*block).match(
       [&](const auto &block_json) {
-        return flat_file_storage_->add(block->height(),
-                                       stringToBytes(block_json.value));
+        auto bytes = stringToBytes(block_json.value);
+        if (compressor_) {
+          bytes = compressor_->compress(bytes);
+        }
+        return flat_file_storage_->add(block->height(), bytes);
       },
       [this](const auto &error) {
         log_->warn("Error while block serialization: {}", error.error);
@@ -42,6 +49,17 @@ FlatFileBlockStorage::fetch(
     return boost::none;
   }
 
+  if (BlockCompressor::isCompressed(*storage_block)) {
+    if (not compressor_) {
+      log_->warn("Block {} is compressed, but no compressor is set", height);
+      return boost::none;
+    }
+    storage_block = compressor_->decompress(*storage_block);
+    if (not storage_block) {
+      return boost::none;
+    }
+  }
+
   return json_converter_->deserialize(bytesToString(*storage_block))
       .match(
           [&](auto &&block) {
@@ -62,6 +80,9 @@ size_t FlatFileBlockStorage::size() const {
 }
 
 void FlatFileBlockStorage::clear() {
+  if (compressor_) {
+    compressor_->clear();
+  }
   flat_file_storage_->dropAll();
 }
 
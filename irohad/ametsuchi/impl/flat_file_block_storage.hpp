@@ -8,6 +8,7 @@
 
 #include "ametsuchi/block_storage.hpp"
 
+#include "ametsuchi/impl/flat_file/block_compressor.hpp"
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "interfaces/iroha_internal/block_json_converter.hpp"
 #include "logger/logger_fwd.hpp"
@@ -16,11 +17,22 @@ namespace iroha {
   namespace ametsuchi {
     class FlatFileBlockStorage : public BlockStorage {
      public:
+      /// Name of the block store subdirectory with compression dictionaries
+      static const std::string kDictionariesDir;
+
+      /**
+       * @param flat_file - storage of serialized blocks
+       * @param json_converter - block serializer
+       * @param log - logger
+       * @param compressor - compressor of the serialized blocks. Without it,
+       * blocks are stored uncompressed and compressed ones cannot be read
+       */
       FlatFileBlockStorage(
           std::unique_ptr<FlatFile> flat_file,
           std::shared_ptr<shared_model::interface::BlockJsonConverter>
               json_converter,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<BlockCompressor> compressor = nullptr);
 
       bool insert(
           std::shared_ptr<const shared_model::interface::Block> block) override;
@@ -38,6 +50,7 @@ namespace iroha {
       std::unique_ptr<FlatFile> flat_file_storage_;
       std::shared_ptr<shared_model::interface::BlockJsonConverter>
           json_converter_;
+      std::shared_ptr<BlockCompressor> compressor_;
       logger::LoggerPtr log_;
     };
   }  // namespace ametsuchi
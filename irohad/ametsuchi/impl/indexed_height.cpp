@@ -0,0 +1,44 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/indexed_height.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    void IndexedHeight::committed(HeightType height) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      committed_ = height;
+    }
+
+    void IndexedHeight::indexed(HeightType height) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        indexed_ = height;
+      }
+      indexed_cv_.notify_all();
+    }
+
+    IndexedHeight::HeightType IndexedHeight::getCommitted() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return committed_;
+    }
+
+    IndexedHeight::HeightType IndexedHeight::getIndexed() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return indexed_;
+    }
+
+    bool IndexedHeight::waitIndexed(std::chrono::milliseconds timeout) const {
+      std::unique_lock<std::mutex> lock(mutex_);
+      // the committed height at the moment of the call is awaited, so that
+      // the blocks committed meanwhile do not prolong the wait
+      const auto committed = committed_;
+      return indexed_cv_.wait_for(
+          lock, timeout, [&] { return indexed_ >= committed; });
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
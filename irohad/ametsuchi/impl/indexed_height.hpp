@@ -0,0 +1,56 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_INDEXED_HEIGHT_HPP
+#define IROHA_INDEXED_HEIGHT_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Watermark of the transaction position indexes, which are written in
+     * background after the commit of a block. Queries which read the indexes
+     * wait until the indexes reach the committed height.
+     */
+    class IndexedHeight {
+     public:
+      using HeightType = shared_model::interface::types::HeightType;
+
+      /// Set the height of the last committed block
+      void committed(HeightType height);
+
+      /// Set the height of the last indexed block
+      void indexed(HeightType height);
+
+      /// @return height of the last committed block
+      HeightType getCommitted() const;
+
+      /// @return height of the last indexed block
+      HeightType getIndexed() const;
+
+      /**
+       * Wait until all committed blocks are indexed
+       * @param timeout - maximal time to wait
+       * @return true if the indexes are at the committed height
+       */
+      bool waitIndexed(std::chrono::milliseconds timeout) const;
+
+     private:
+      mutable std::mutex mutex_;
+      mutable std::condition_variable indexed_cv_;
+      HeightType committed_ = 0;
+      HeightType indexed_ = 0;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_INDEXED_HEIGHT_HPP
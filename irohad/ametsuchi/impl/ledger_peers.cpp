@@ -0,0 +1,37 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/ledger_peers.hpp"
+
+#include <algorithm>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/remove_peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    bool changesLedgerPeers(const shared_model::interface::Block &block) {
+      auto changes_peers = [](const shared_model::interface::Command &command) {
+        return iroha::visit_in_place(
+            command.get(),
+            [](const shared_model::interface::AddPeer &) { return true; },
+            [](const shared_model::interface::RemovePeer &) { return true; },
+            [](const auto &) { return false; });
+      };
+      const auto &transactions = block.transactions();
+      return std::any_of(
+          transactions.begin(), transactions.end(), [&](const auto &tx) {
+            const auto &commands = tx.commands();
+            return std::any_of(commands.begin(), commands.end(), changes_peers);
+          });
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
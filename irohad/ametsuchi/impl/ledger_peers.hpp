@@ -0,0 +1,51 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LEDGER_PEERS_HPP
+#define IROHA_LEDGER_PEERS_HPP
+
+#include <memory>
+
+#include <boost/optional.hpp>
+#include "ametsuchi/ledger_state.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /// @return true if the block has AddPeer or RemovePeer commands
+    bool changesLedgerPeers(const shared_model::interface::Block &block);
+
+    /**
+     * Get ledger peers after the block. Peers are changed only by AddPeer and
+     * RemovePeer commands, so the immutable peers of the previous ledger state
+     * are shared unless the block has such commands, and are fetched from WSV
+     * otherwise.
+     * @param block - block applied on top of the previous ledger state
+     * @param previous_state - ledger state before the block, if any
+     * @param fetch_peers - callable which returns optional peers from WSV
+     * @return ledger peers or none if they could not be fetched
+     */
+    template <typename FetchPeers>
+    boost::optional<shared_model::interface::types::PeerList> getLedgerPeers(
+        const shared_model::interface::Block &block,
+        const boost::optional<std::shared_ptr<const LedgerState>>
+            &previous_state,
+        FetchPeers &&fetch_peers) {
+      if (previous_state and not changesLedgerPeers(block)) {
+        return previous_state.value()->ledger_peers;
+      }
+      return std::forward<FetchPeers>(fetch_peers)();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_LEDGER_PEERS_HPP
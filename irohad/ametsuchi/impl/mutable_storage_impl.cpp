@@ -9,14 +9,15 @@
 #include <boost/variant/apply_visitor.hpp>
 #include <rxcpp/operators/rx-all.hpp>
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/impl/ledger_peers.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_command_coalescer.hpp"
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_indexer.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/ledger_state.hpp"
-#include "ametsuchi/tx_executor.hpp"
 #include "interfaces/commands/command.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
@@ -28,7 +29,8 @@ namespace iroha {
         boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state,
         std::shared_ptr<PostgresCommandExecutor> command_executor,
         std::unique_ptr<BlockStorage> block_storage,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        PostgresBlockIndex::Tables index_tables)
         : ledger_state_(std::move(ledger_state)),
           sql_(command_executor->getSession()),
           wsv_command_(std::make_unique<PostgresWsvCommand>(sql_)),
@@ -37,9 +39,11 @@ namespace iroha {
                   sql_, log_manager->getChild("WsvQuery")->getLogger()))),
           block_index_(std::make_unique<PostgresBlockIndex>(
               std::make_unique<PostgresIndexer>(sql_),
-              log_manager->getChild("PostgresBlockIndex")->getLogger())),
-          transaction_executor_(std::make_unique<TransactionExecutor>(
-              std::move(command_executor))),
+              log_manager->getChild("PostgresBlockIndex")->getLogger(),
+              index_tables)),
+          command_coalescer_(std::make_unique<PostgresCommandCoalescer>(
+              std::move(command_executor),
+              log_manager->getChild("CommandCoalescer")->getLogger())),
           block_storage_(std::move(block_storage)),
           committed(false),
           log_(log_manager->getLogger()) {
@@ -49,8 +53,8 @@ namespace iroha {
     bool MutableStorageImpl::apply(
         std::shared_ptr<const shared_model::interface::Block> block,
         MutableStoragePredicate predicate) {
-      auto execute_transaction = [this](auto &transaction) -> bool {
-        auto result = transaction_executor_->execute(transaction, false);
+      auto execute_transactions = [this, &block]() -> bool {
+        auto result = command_coalescer_->execute(block->transactions());
         auto error = expected::resultToOptionalError(result);
         if (error) {
           log_->error(error->command_error.toString());
@@ -61,13 +65,11 @@ namespace iroha {
 
       log_->info("Applying block: height {}, hash {}",
                  block->height(),
-                 block->hash().hex());
+                 logger::lazy([&block] { return block->hash().hex(); }));
 
       auto block_applied =
           (not ledger_state_ or predicate(block, *ledger_state_.value()))
-          and std::all_of(block->transactions().begin(),
-                          block->transactions().end(),
-                          execute_transaction);
+          and execute_transactions();
       if (block_applied) {
         if (auto e =
                 expected::resultToOptionalError(wsv_command_->setTopBlockInfo(
@@ -79,7 +81,10 @@ namespace iroha {
         block_storage_->insert(block);
         block_index_->index(*block);
 
-        auto opt_ledger_peers = peer_query_->getLedgerPeers();
+        auto opt_ledger_peers =
+            getLedgerPeers(*block, ledger_state_, [this] {
+              return peer_query_->getLedgerPeers();
+            });
         if (not opt_ledger_peers) {
           log_->error("Failed to get ledger peers!");
           return false;
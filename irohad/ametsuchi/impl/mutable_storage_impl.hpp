@@ -10,6 +10,7 @@
 
 #include <soci/soci.h>
 #include "ametsuchi/block_storage.hpp"
+#include "ametsuchi/impl/postgres_block_index.hpp"
 #include "common/result.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
@@ -19,9 +20,9 @@ namespace iroha {
   namespace ametsuchi {
     class BlockIndex;
     class PeerQuery;
+    class PostgresCommandCoalescer;
     class PostgresCommandExecutor;
     class PostgresWsvCommand;
-    class TransactionExecutor;
 
     class MutableStorageImpl : public MutableStorage {
       friend class StorageImpl;
@@ -32,7 +33,9 @@ namespace iroha {
               ledger_state,
           std::shared_ptr<PostgresCommandExecutor> command_executor,
           std::unique_ptr<BlockStorage> block_storage,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          PostgresBlockIndex::Tables index_tables =
+              PostgresBlockIndex::Tables::kAll);
 
       bool apply(
           std::shared_ptr<const shared_model::interface::Block> block) override;
@@ -42,7 +45,7 @@ namespace iroha {
                  MutableStoragePredicate predicate) override;
 
       boost::optional<std::shared_ptr<const iroha::LedgerState>>
-      getLedgerState() const;
+      getLedgerState() const override;
 
       expected::Result<CommitResult, std::string> commit() && override;
 
@@ -70,7 +73,7 @@ namespace iroha {
       std::unique_ptr<PostgresWsvCommand> wsv_command_;
       std::unique_ptr<PeerQuery> peer_query_;
       std::unique_ptr<BlockIndex> block_index_;
-      std::shared_ptr<TransactionExecutor> transaction_executor_;
+      std::unique_ptr<PostgresCommandCoalescer> command_coalescer_;
       std::unique_ptr<BlockStorage> block_storage_;
 
       bool committed;
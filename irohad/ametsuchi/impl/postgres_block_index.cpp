@@ -68,33 +68,47 @@ void PostgresBlockIndex::makeAccountAssetIndex(
 }
 
 PostgresBlockIndex::PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
-                                       logger::LoggerPtr log)
-    : indexer_(std::move(indexer)), log_(std::move(log)) {}
+                                       logger::LoggerPtr log,
+                                       Tables tables)
+    : indexer_(std::move(indexer)), log_(std::move(log)), tables_(tables) {}
 
 void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
+  if (auto e = resultToOptionalError(tryIndex(block))) {
+    log_->error(e.value());
+  }
+}
+
+iroha::expected::Result<void, std::string> PostgresBlockIndex::tryIndex(
+    const shared_model::interface::Block &block) {
+  const bool statuses = tables_ != Tables::kTxPositions;
+  const bool positions = tables_ != Tables::kTxStatuses;
   auto height = block.height();
   for (const auto &tx : block.transactions() | boost::adaptors::indexed(0)) {
     const auto &creator_id = tx.value().creatorAccountId();
     const TxPosition position{height, static_cast<size_t>(tx.index())};
 
-    indexer_->committedTxHash(tx.value().hash());
-    makeAccountAssetIndex(creator_id,
-                          tx.value().hash(),
-                          tx.value().createdTime(),
-                          position,
-                          tx.value().commands());
-    indexer_->txPositions(creator_id,
-                          tx.value().hash(),
-                          boost::none,
-                          tx.value().createdTime(),
-                          position);
+    if (statuses) {
+      indexer_->committedTxHash(tx.value().hash());
+    }
+    if (positions) {
+      makeAccountAssetIndex(creator_id,
+                            tx.value().hash(),
+                            tx.value().createdTime(),
+                            position,
+                            tx.value().commands());
+      indexer_->txPositions(creator_id,
+                            tx.value().hash(),
+                            boost::none,
+                            tx.value().createdTime(),
+                            position);
+    }
   }
 
-  for (const auto &rejected_tx_hash : block.rejected_transactions_hashes()) {
-    indexer_->rejectedTxHash(rejected_tx_hash);
+  if (statuses) {
+    for (const auto &rejected_tx_hash : block.rejected_transactions_hashes()) {
+      indexer_->rejectedTxHash(rejected_tx_hash);
+    }
   }
 
-  if (auto e = resultToOptionalError(indexer_->flush())) {
-    log_->error(e.value());
-  }
+  return indexer_->flush();
 }
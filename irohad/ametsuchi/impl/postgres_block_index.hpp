@@ -29,12 +29,27 @@ namespace iroha {
      */
     class PostgresBlockIndex : public BlockIndex {
      public:
+      /// Tables filled by the index
+      enum class Tables {
+        kAll,
+        /// statuses of committed and rejected transactions by hash
+        kTxStatuses,
+        /// positions of transactions by creator, account and asset
+        kTxPositions
+      };
+
       PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
-                         logger::LoggerPtr log);
+                         logger::LoggerPtr log,
+                         Tables tables = Tables::kAll);
 
       /// Index a block.
       void index(const shared_model::interface::Block &block) override;
 
+      /// Index a block.
+      /// @return error if the index is not written
+      iroha::expected::Result<void, std::string> tryIndex(
+          const shared_model::interface::Block &block);
+
      private:
       /// Index a transaction.
       void makeAccountAssetIndex(
@@ -46,6 +61,7 @@ namespace iroha {
 
       std::unique_ptr<Indexer> indexer_;
       logger::LoggerPtr log_;
+      Tables tables_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
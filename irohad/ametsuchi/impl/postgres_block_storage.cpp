@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 
+#include "backend/protobuf/util.hpp"
 #include "common/hexutils.hpp"
 #include "logger/logger.hpp"
 
@@ -73,11 +74,13 @@ PostgresBlockStorage::fetch(
       log_->debug("fetched: {}", block_data);
       return iroha::hexstringToBytestring(block_data) |
           [&, this](auto byte_block) {
-            iroha::protocol::Block_v1 b1;
-            b1.ParseFromString(byte_block);
-            iroha::protocol::Block block;
-            *block.mutable_block_v1() = b1;
-            return block_factory_->createBlock(std::move(block))
+            // the block is parsed right into its arena, which is freed with
+            // the created block
+            auto arena = shared_model::proto::makeArena(byte_block.size());
+            auto &block = *google::protobuf::Arena::CreateMessage<
+                iroha::protocol::Block>(arena.get());
+            block.mutable_block_v1()->ParseFromString(byte_block);
+            return block_factory_->createBlock(std::move(arena), block)
                 .match(
                     [&](auto &&v) {
                       return boost::make_optional(
@@ -0,0 +1,316 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_command_coalescer.hpp"
+
+#include <ciso646>
+
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/soci_utils.hpp"
+#include "common/visitor.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /**
+   * Balances after each transfer are calculated in the order of the
+   * transfers, so the checks of enough source quantity and of destination
+   * overflow are made for every transfer, as the sequential execution does.
+   */
+  const std::string kTransferAssets = R"(
+      WITH transfers AS
+      (
+          SELECT * FROM unnest(:sources::text[],
+                               :destinations::text[],
+                               :asset_ids::text[],
+                               :quantities::decimal[],
+                               :precisions::int[])
+              WITH ORDINALITY
+              AS t(source, destination, asset_id, quantity, precision, ord)
+      ),
+      deltas AS
+      (
+          SELECT source AS account_id, asset_id, -quantity AS delta, ord,
+              false AS receives
+          FROM transfers
+          UNION ALL
+          SELECT destination, asset_id, quantity, ord, true
+          FROM transfers
+      ),
+      balances AS
+      (
+          SELECT d.account_id, d.asset_id, d.receives, d.ord,
+              coalesce(aha.amount, 0) + sum(d.delta) OVER (
+                  PARTITION BY d.account_id, d.asset_id ORDER BY d.ord)
+              AS value
+          FROM deltas AS d
+          LEFT JOIN account_has_asset AS aha
+              ON aha.account_id = d.account_id AND aha.asset_id = d.asset_id
+      ),
+      checks AS
+      (
+          SELECT
+              -- accounts exist
+              NOT EXISTS (SELECT * FROM deltas AS d WHERE NOT EXISTS
+                  (SELECT * FROM account AS a
+                   WHERE a.account_id = d.account_id))
+              -- assets exist
+              AND NOT EXISTS (SELECT * FROM transfers AS t WHERE NOT EXISTS
+                  (SELECT * FROM asset AS a
+                   WHERE a.asset_id = t.asset_id
+                       AND a.precision >= t.precision))
+              -- enough source quantity and no destination overflow
+              AND NOT EXISTS (SELECT * FROM balances AS b
+                  JOIN asset AS a ON a.asset_id = b.asset_id
+                  WHERE b.value < 0
+                      OR (b.receives AND b.value >= (2::decimal ^ 256)
+                          / (10::decimal ^ a.precision)))
+              AS result
+      ),
+      final_balances AS
+      (
+          SELECT DISTINCT ON (account_id, asset_id) account_id, asset_id, value
+          FROM balances
+          ORDER BY account_id, asset_id, ord DESC
+      ),
+      inserted AS
+      (
+          INSERT INTO account_has_asset(account_id, asset_id, amount)
+          (
+              SELECT account_id, asset_id, value FROM final_balances
+              WHERE (SELECT result FROM checks)
+          )
+          ON CONFLICT (account_id, asset_id)
+          DO UPDATE SET amount = EXCLUDED.amount
+          RETURNING account_id, (xmax = 0) AS is_new
+      ),
+      counted AS
+      (
+          INSERT INTO account_has_asset_count(account_id, asset_count)
+          SELECT account_id, count(*) FROM inserted WHERE is_new
+          GROUP BY account_id
+          ON CONFLICT (account_id) DO UPDATE
+          SET asset_count =
+              account_has_asset_count.asset_count + EXCLUDED.asset_count
+      )
+      SELECT CASE WHEN (SELECT result FROM checks) THEN 0 ELSE 1 END)";
+
+  /// Only the last value of a key is written, and the details of each account
+  /// are merged with a single update.
+  const std::string kSetAccountDetails = R"(
+      WITH details AS
+      (
+          SELECT * FROM unnest(:creators::text[],
+                               :targets::text[],
+                               :keys::text[],
+                               :values::jsonb[])
+              WITH ORDINALITY AS d(creator, target, key, value, ord)
+      ),
+      last_values AS
+      (
+          SELECT DISTINCT ON (target, creator, key) target, creator, key, value
+          FROM details
+          ORDER BY target, creator, key, ord DESC
+      ),
+      per_creator AS
+      (
+          SELECT target, creator, jsonb_object_agg(key, value) AS data
+          FROM last_values
+          GROUP BY target, creator
+      ),
+      checks AS
+      (
+          SELECT NOT EXISTS (SELECT * FROM per_creator AS p WHERE NOT EXISTS
+              (SELECT * FROM account AS a WHERE a.account_id = p.target))
+              AS result
+      ),
+      updated AS
+      (
+          UPDATE account SET data = account.data ||
+          (
+              SELECT jsonb_object_agg(p.creator,
+                  coalesce(account.data -> p.creator, '{}'::jsonb) || p.data)
+              FROM per_creator AS p
+              WHERE p.target = account.account_id
+          )
+          WHERE account_id IN (SELECT target FROM per_creator)
+              AND (SELECT result FROM checks)
+      )
+      SELECT CASE WHEN (SELECT result FROM checks) THEN 0 ELSE 1 END)";
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    PostgresCommandCoalescer::PostgresCommandCoalescer(
+        std::shared_ptr<PostgresCommandExecutor> command_executor,
+        logger::LoggerPtr log)
+        : command_executor_(std::move(command_executor)),
+          log_(std::move(log)) {}
+
+    iroha::expected::Result<void, TxExecutionError>
+    PostgresCommandCoalescer::execute(
+        const shared_model::interface::types::TransactionsCollectionType
+            &transactions) {
+      std::vector<CommandRef> run;
+      RunType run_type = RunType::kNone;
+
+      auto flush_run = [&]() -> iroha::expected::Result<void, TxExecutionError> {
+        if (run.empty()) {
+          return {};
+        }
+        iroha::expected::Result<void, TxExecutionError> result{};
+        if (run.size() < kMinRunSize or not executeCoalesced(run_type, run)) {
+          result = executeSequentially(run);
+        }
+        run.clear();
+        return result;
+      };
+
+      for (const auto &transaction : transactions) {
+        size_t index = 0;
+        for (const auto &command : transaction.commands()) {
+          auto type = getRunType(command);
+          if (type != run_type) {
+            if (auto error =
+                    iroha::expected::resultToOptionalError(flush_run())) {
+              return iroha::expected::makeError(std::move(*error));
+            }
+            run_type = type;
+          }
+          run.push_back(CommandRef{&command, &transaction, index++});
+          if (run_type == RunType::kNone) {
+            if (auto error =
+                    iroha::expected::resultToOptionalError(flush_run())) {
+              return iroha::expected::makeError(std::move(*error));
+            }
+          }
+        }
+      }
+      return flush_run();
+    }
+
+    PostgresCommandCoalescer::RunType PostgresCommandCoalescer::getRunType(
+        const shared_model::interface::Command &command) {
+      return iroha::visit_in_place(
+          command.get(),
+          [](const shared_model::interface::TransferAsset &c) {
+            // the sequential execution of a transfer to the source account
+            // writes the same row twice, it is kept as it is
+            return c.srcAccountId() == c.destAccountId()
+                ? RunType::kNone
+                : RunType::kTransferAsset;
+          },
+          [](const shared_model::interface::SetAccountDetail &) {
+            return RunType::kSetAccountDetail;
+          },
+          [](const auto &) { return RunType::kNone; });
+    }
+
+    iroha::expected::Result<void, TxExecutionError>
+    PostgresCommandCoalescer::executeSequentially(
+        const std::vector<CommandRef> &run) {
+      for (const auto &ref : run) {
+        if (auto error = iroha::expected::resultToOptionalError(
+                command_executor_->execute(
+                    *ref.command,
+                    ref.transaction->creatorAccountId(),
+                    ref.transaction->hash().hex(),
+                    ref.index,
+                    false))) {
+          return iroha::expected::makeError(
+              TxExecutionError{std::move(*error), ref.index});
+        }
+      }
+      return {};
+    }
+
+    bool PostgresCommandCoalescer::executeCoalesced(
+        RunType type, const std::vector<CommandRef> &run) {
+      auto &sql = command_executor_->getSession();
+      sql << "SAVEPOINT coalesced_commands_";
+      bool applied = false;
+      try {
+        applied = type == RunType::kTransferAsset ? applyTransfers(run)
+                                                  : applyAccountDetails(run);
+      } catch (const std::exception &e) {
+        log_->debug("Failed to apply {} commands at once: {}",
+                    run.size(),
+                    e.what());
+      }
+      if (applied) {
+        sql << "RELEASE SAVEPOINT coalesced_commands_";
+      } else {
+        sql << "ROLLBACK TO SAVEPOINT coalesced_commands_";
+      }
+      return applied;
+    }
+
+    bool PostgresCommandCoalescer::applyTransfers(
+        const std::vector<CommandRef> &run) {
+      std::vector<std::string> sources, destinations, asset_ids, quantities,
+          precisions;
+      for (const auto &ref : run) {
+        const auto &transfer =
+            boost::get<const shared_model::interface::TransferAsset &>(
+                ref.command->get());
+        sources.push_back(transfer.srcAccountId());
+        destinations.push_back(transfer.destAccountId());
+        asset_ids.push_back(transfer.assetId());
+        quantities.push_back(transfer.amount().toStringRepr());
+        precisions.push_back(std::to_string(transfer.amount().precision()));
+      }
+
+      const auto sources_array = makePostgresArray(sources);
+      const auto destinations_array = makePostgresArray(destinations);
+      const auto asset_ids_array = makePostgresArray(asset_ids);
+      const auto quantities_array = makePostgresArray(quantities);
+      const auto precisions_array = makePostgresArray(precisions);
+      int result = 1;
+      command_executor_->getSession() << kTransferAssets,
+          soci::use(sources_array, "sources"),
+          soci::use(destinations_array, "destinations"),
+          soci::use(asset_ids_array, "asset_ids"),
+          soci::use(quantities_array, "quantities"),
+          soci::use(precisions_array, "precisions"), soci::into(result);
+      return result == 0;
+    }
+
+    bool PostgresCommandCoalescer::applyAccountDetails(
+        const std::vector<CommandRef> &run) {
+      // when creator is not known, it is genesis block
+      static const std::string kGenesisCreator = "genesis";
+
+      std::vector<std::string> creators, targets, keys, values;
+      for (const auto &ref : run) {
+        const auto &detail =
+            boost::get<const shared_model::interface::SetAccountDetail &>(
+                ref.command->get());
+        const auto &creator = ref.transaction->creatorAccountId();
+        creators.push_back(creator.empty() ? kGenesisCreator : creator);
+        targets.push_back(detail.accountId());
+        keys.push_back(detail.key());
+        // the value is stored as a JSON string, as by the command executor
+        values.push_back("\"" + detail.value() + "\"");
+      }
+
+      const auto creators_array = makePostgresArray(creators);
+      const auto targets_array = makePostgresArray(targets);
+      const auto keys_array = makePostgresArray(keys);
+      const auto values_array = makePostgresArray(values);
+      int result = 1;
+      command_executor_->getSession() << kSetAccountDetails,
+          soci::use(creators_array, "creators"),
+          soci::use(targets_array, "targets"), soci::use(keys_array, "keys"),
+          soci::use(values_array, "values"), soci::into(result);
+      return result == 0;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,87 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_COMMAND_COALESCER_HPP
+#define IROHA_POSTGRES_COMMAND_COALESCER_HPP
+
+#include <memory>
+#include <vector>
+
+#include "ametsuchi/tx_executor.hpp"
+#include "interfaces/common_objects/range_types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Command;
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class PostgresCommandExecutor;
+
+    /**
+     * Executes commands of already validated transactions, e.g. of a
+     * committed block, without validation. Runs of consecutive TransferAsset
+     * or SetAccountDetail commands are applied with a single set-based
+     * statement each. When such a statement reports that a command of the run
+     * would fail, its changes are rolled back and the run is executed command
+     * by command, so the result and the error are the same as of sequential
+     * execution.
+     */
+    class PostgresCommandCoalescer {
+     public:
+      /// minimal number of consecutive commands of the same type applied with
+      /// a single statement
+      static constexpr size_t kMinRunSize = 2;
+
+      PostgresCommandCoalescer(
+          std::shared_ptr<PostgresCommandExecutor> command_executor,
+          logger::LoggerPtr log);
+
+      /**
+       * Execute commands of the transactions in order
+       * @param transactions - transactions, commands of which are coalesced
+       * across transaction boundaries
+       * @return error of the first failed command
+       */
+      iroha::expected::Result<void, TxExecutionError> execute(
+          const shared_model::interface::types::TransactionsCollectionType
+              &transactions);
+
+     private:
+      enum class RunType { kNone, kTransferAsset, kSetAccountDetail };
+
+      struct CommandRef {
+        const shared_model::interface::Command *command;
+        const shared_model::interface::Transaction *transaction;
+        size_t index;
+      };
+
+      static RunType getRunType(const shared_model::interface::Command &command);
+
+      /// Execute the run command by command
+      iroha::expected::Result<void, TxExecutionError> executeSequentially(
+          const std::vector<CommandRef> &run);
+
+      /// Apply the run with a single statement
+      /// @return true if all commands of the run are applied
+      bool executeCoalesced(RunType type, const std::vector<CommandRef> &run);
+
+      bool applyTransfers(const std::vector<CommandRef> &run);
+
+      bool applyAccountDetails(const std::vector<CommandRef> &run);
+
+      std::shared_ptr<PostgresCommandExecutor> command_executor_;
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_COMMAND_COALESCER_HPP
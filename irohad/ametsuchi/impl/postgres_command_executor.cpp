@@ -555,7 +555,14 @@ namespace iroha {
                 )
                 ON CONFLICT (account_id, asset_id) DO UPDATE
                 SET amount = EXCLUDED.amount
-                RETURNING (1)
+                RETURNING account_id, (xmax = 0) AS is_new
+             ),
+             counted AS
+             (
+                INSERT INTO account_has_asset_count(account_id, asset_count)
+                SELECT account_id, 1 FROM inserted WHERE is_new
+                ON CONFLICT (account_id) DO UPDATE
+                SET asset_count = account_has_asset_count.asset_count + 1
              )
           SELECT CASE
               %s
@@ -1253,7 +1260,14 @@ namespace iroha {
                )
                ON CONFLICT (account_id, asset_id)
                DO UPDATE SET amount = EXCLUDED.amount
-               RETURNING (1)
+               RETURNING account_id, (xmax = 0) AS is_new
+            ),
+            counted AS
+            (
+               INSERT INTO account_has_asset_count(account_id, asset_count)
+               SELECT account_id, 1 FROM inserted WHERE is_new
+               ON CONFLICT (account_id) DO UPDATE
+               SET asset_count = account_has_asset_count.asset_count + 1
             )
           SELECT CASE
               WHEN EXISTS (SELECT * FROM inserted LIMIT 1) THEN 0
@@ -1345,7 +1359,14 @@ namespace iroha {
                 )
                 ON CONFLICT (account_id, asset_id)
                 DO UPDATE SET amount = EXCLUDED.amount
-                RETURNING (1)
+                RETURNING account_id, (xmax = 0) AS is_new
+            ),
+            counted AS
+            (
+                INSERT INTO account_has_asset_count(account_id, asset_count)
+                SELECT account_id, 1 FROM insert_dest WHERE is_new
+                ON CONFLICT (account_id) DO UPDATE
+                SET asset_count = account_has_asset_count.asset_count + 1
             )
           SELECT CASE
               WHEN EXISTS (SELECT * FROM insert_dest LIMIT 1) THEN 0
@@ -85,6 +85,17 @@ PostgresOptions::PostgresOptions(const std::string &host,
   }
 }
 
+PostgresOptions::PostgresOptions(const PostgresOptions &options,
+                                 const std::string &host,
+                                 uint16_t port)
+    : host_(host),
+      port_(port),
+      user_(options.user_),
+      password_(options.password_),
+      working_dbname_(options.working_dbname_),
+      maintenance_dbname_(options.maintenance_dbname_),
+      prepared_block_name_(options.prepared_block_name_) {}
+
 std::string PostgresOptions::connectionStringWithoutDbName() const {
   return (boost::format("host=%1% port=%2% user=%3% password=%4%") % host_
           % port_ % user_ % password_)
@@ -49,6 +49,16 @@ namespace iroha {
                       const std::string &maintenance_dbname,
                       logger::LoggerPtr log);
 
+      /**
+       * Options for the same databases on another server, e.g. a hot standby.
+       * @param options Options to copy the credentials and databases from.
+       * @param host PostgreSQL host.
+       * @param port PostgreSQL port.
+       */
+      PostgresOptions(const PostgresOptions &options,
+                      const std::string &host,
+                      uint16_t port);
+
       /// @return connection string without dbname param
       std::string connectionStringWithoutDbName() const;
 
@@ -7,10 +7,17 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/size.hpp>
+#include "ametsuchi/impl/indexed_height.hpp"
 #include "ametsuchi/specific_query_executor.hpp"
+#include "common/visitor.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "interfaces/queries/blocks_query.hpp"
+#include "interfaces/queries/get_account_asset_transactions.hpp"
+#include "interfaces/queries/get_account_transactions.hpp"
+#include "interfaces/queries/get_engine_receipts.hpp"
+#include "interfaces/queries/get_transactions.hpp"
 #include "interfaces/queries/query.hpp"
+#include "interfaces/query_responses/query_response.hpp"
 #include "logger/logger.hpp"
 
 using namespace shared_model::interface::permissions;
@@ -23,11 +30,13 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::QueryResponseFactory>
             response_factory,
         std::shared_ptr<SpecificQueryExecutor> specific_query_executor,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<const IndexedHeight> indexed_height)
         : sql_(std::move(sql)),
           specific_query_executor_(std::move(specific_query_executor)),
           query_response_factory_{std::move(response_factory)},
-          log_(std::move(log)) {}
+          log_(std::move(log)),
+          indexed_height_(std::move(indexed_height)) {}
 
     template <class Q>
     bool PostgresQueryExecutor::validateSignatures(const Q &query) {
@@ -61,20 +70,78 @@ namespace iroha {
       return signatories_valid and *signatories_valid;
     }
 
+    void PostgresQueryExecutor::waitForTxPositions(
+        const shared_model::interface::Query &query) {
+      using namespace shared_model::interface;
+      if (not indexed_height_
+          or not iroha::visit_in_place(
+                 query.get(),
+                 [](const GetAccountTransactions &) { return true; },
+                 [](const GetAccountAssetTransactions &) { return true; },
+                 [](const GetTransactions &) { return true; },
+                 [](const GetEngineReceipts &) { return true; },
+                 [](const auto &) { return false; })) {
+        return;
+      }
+      // queries are not delayed for long, they report the lagging indexes
+      // and return what is indexed
+      static constexpr std::chrono::seconds kTxPositionsTimeout{5};
+      if (not indexed_height_->waitIndexed(kTxPositionsTimeout)) {
+        log_->warn(
+            "Transaction positions are indexed up to height {} of {}, the "
+            "result may be incomplete",
+            indexed_height_->getIndexed(),
+            indexed_height_->getCommitted());
+      }
+    }
+
+    boost::optional<shared_model::interface::types::HeightType>
+    PostgresQueryExecutor::beginSnapshot() {
+      size_t height = 0;
+      try {
+        *sql_ << "BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY";
+        // the snapshot is taken by the first statement of the transaction
+        *sql_ << "SELECT height FROM top_block_info", soci::into(height);
+      } catch (const std::exception &e) {
+        log_->warn("Cannot start a snapshot for the query: {}", e.what());
+        endSnapshot();
+        return boost::none;
+      }
+      return height;
+    }
+
+    void PostgresQueryExecutor::endSnapshot() {
+      try {
+        *sql_ << "ROLLBACK";
+      } catch (const std::exception &e) {
+        log_->warn("Cannot finish the query snapshot: {}", e.what());
+      }
+    }
+
     QueryExecutorResult PostgresQueryExecutor::validateAndExecute(
         const shared_model::interface::Query &query,
         const bool validate_signatories = true) {
-      if (validate_signatories and not validateSignatures(query)) {
-        // TODO [IR-1816] Akvinikym 03.12.18: replace magic number 3
-        // with a named constant
-        return query_response_factory_->createErrorQueryResponse(
-            shared_model::interface::QueryResponseFactory::ErrorQueryType::
-                kStatefulFailed,
-            "query signatories did not pass validation",
-            3,
-            query.hash());
+      waitForTxPositions(query);
+      const auto height = beginSnapshot();
+      const auto snapshot_height = height.value_or(0);
+      auto response = [&] {
+        if (validate_signatories and not validateSignatures(query)) {
+          // TODO [IR-1816] Akvinikym 03.12.18: replace magic number 3
+          // with a named constant
+          return query_response_factory_->createErrorQueryResponse(
+              shared_model::interface::QueryResponseFactory::ErrorQueryType::
+                  kStatefulFailed,
+              "query signatories did not pass validation",
+              3,
+              query.hash(),
+              snapshot_height);
+        }
+        return specific_query_executor_->execute(query, snapshot_height);
+      }();
+      if (height) {
+        endSnapshot();
       }
-      return specific_query_executor_->execute(query);
+      return response;
     }
 
     bool PostgresQueryExecutor::validate(
@@ -9,6 +9,8 @@
 #include "ametsuchi/query_executor.hpp"
 
 #include <soci/soci.h>
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace shared_model {
@@ -20,6 +22,7 @@ namespace shared_model {
 namespace iroha {
   namespace ametsuchi {
 
+    class IndexedHeight;
     class SpecificQueryExecutor;
 
     class PostgresQueryExecutor : public QueryExecutor {
@@ -29,7 +32,8 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::QueryResponseFactory>
               response_factory,
           std::shared_ptr<SpecificQueryExecutor> specific_query_executor,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<const IndexedHeight> indexed_height = nullptr);
 
       QueryExecutorResult validateAndExecute(
           const shared_model::interface::Query &query,
@@ -42,11 +46,31 @@ namespace iroha {
       template <class Q>
       bool validateSignatures(const Q &query);
 
+      /**
+       * Wait until transaction positions of all committed blocks are written,
+       * if they are written in background and the query reads them. It is
+       * called before beginSnapshot, so that the snapshot sees the indexes
+       */
+      void waitForTxPositions(const shared_model::interface::Query &query);
+
+      /**
+       * Start a read-only transaction working on a snapshot of the ledger
+       * state, so that all statements of a query see the same committed block
+       * @return height of the ledger state in the snapshot, or none if the
+       * transaction could not be started
+       */
+      boost::optional<shared_model::interface::types::HeightType>
+      beginSnapshot();
+
+      /// Finish the transaction started with beginSnapshot
+      void endSnapshot();
+
       std::unique_ptr<soci::session> sql_;
       std::shared_ptr<SpecificQueryExecutor> specific_query_executor_;
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
           query_response_factory_;
       logger::LoggerPtr log_;
+      std::shared_ptr<const IndexedHeight> indexed_height_;
     };
 
   }  // namespace ametsuchi
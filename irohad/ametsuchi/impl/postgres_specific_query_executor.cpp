@@ -289,10 +289,12 @@ namespace iroha {
     }
 
     QueryExecutorResult PostgresSpecificQueryExecutor::execute(
-        const shared_model::interface::Query &qry) {
+        const shared_model::interface::Query &qry,
+        shared_model::interface::types::HeightType snapshot_height) {
       return boost::apply_visitor(
-          [this, &qry](const auto &query) {
-            return (*this)(query, qry.creatorAccountId(), qry.hash());
+          [this, &qry, snapshot_height](const auto &query) {
+            return (*this)(
+                query, qry.creatorAccountId(), qry.hash(), snapshot_height);
           },
           qry.get());
     }
@@ -337,6 +339,7 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::executeQuery(
         QueryExecutor &&query_executor,
         const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height,
         ResponseCreator &&response_creator,
         PermissionsErrResponse &&perms_err_response) {
       using T = concat<QueryTuple, PermissionTuple>;
@@ -346,8 +349,12 @@ namespace iroha {
 
         return iroha::ametsuchi::apply(
             viewPermissions<PermissionTuple>(range.front()),
-            [this, range, &response_creator, &perms_err_response, &query_hash](
-                auto... perms) {
+            [this,
+             range,
+             &response_creator,
+             &perms_err_response,
+             &query_hash,
+             snapshot_height](auto... perms) {
               bool temp[] = {not perms...};
               if (std::all_of(std::begin(temp), std::end(temp), [](auto b) {
                     return b;
@@ -358,7 +365,8 @@ namespace iroha {
                     QueryErrorType::kStatefulFailed,
                     std::forward<PermissionsErrResponse>(perms_err_response)(),
                     2,
-                    query_hash);
+                    query_hash,
+                    snapshot_height);
               }
               auto query_range =
                   range | boost::adaptors::transformed([](auto &t) {
@@ -368,8 +376,11 @@ namespace iroha {
                   query_range, perms...);
             });
       } catch (const std::exception &e) {
-        return this->logAndReturnErrorResponse(
-            QueryErrorType::kStatefulFailed, e.what(), 1, query_hash);
+        return this->logAndReturnErrorResponse(QueryErrorType::kStatefulFailed,
+                                               e.what(),
+                                               1,
+                                               query_hash,
+                                               snapshot_height);
       }
     }
 
@@ -394,7 +405,8 @@ namespace iroha {
         QueryErrorType error_type,
         QueryErrorMessageType error_body,
         QueryErrorCodeType error_code,
-        const shared_model::interface::types::HashType &query_hash) const {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) const {
       std::string error;
       switch (error_type) {
         case QueryErrorType::kNoAccount:
@@ -423,7 +435,7 @@ namespace iroha {
 
       log_->error("{}", error);
       return query_response_factory_->createErrorQueryResponse(
-          error_type, error, error_code, query_hash);
+          error_type, error, error_code, query_hash, snapshot_height);
     }
 
     template <typename Query,
@@ -434,6 +446,7 @@ namespace iroha {
         const Query &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height,
         QueryChecker &&qry_checker,
         char const *related_txs,
         QueryApplier applier,
@@ -470,7 +483,8 @@ namespace iroha {
         return this->logAndReturnErrorResponse(QueryErrorType::kStatefulFailed,
                                                "Ordering query failed.",
                                                1,
-                                               query_hash);
+                                               query_hash,
+                                               snapshot_height);
       }
 
       auto query = fmt::format(
@@ -486,6 +500,7 @@ namespace iroha {
       return executeQuery<QueryTuple, PermissionTuple>(
           applier(query),
           query_hash,
+          snapshot_height,
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             uint64_t total_size = 0;
@@ -513,7 +528,11 @@ namespace iroha {
                   std::back_inserter(response_txs));
               if (auto e = iroha::expected::resultToOptionalError(txs_result)) {
                 return this->logAndReturnErrorResponse(
-                    QueryErrorType::kStatefulFailed, e.value(), 1, query_hash);
+                    QueryErrorType::kStatefulFailed,
+                    e.value(),
+                    1,
+                    query_hash,
+                    snapshot_height);
               }
             }
 
@@ -525,7 +544,11 @@ namespace iroha {
                 auto error = fmt::format("invalid pagination hash: {}",
                                          first_hash->hex());
                 return this->logAndReturnErrorResponse(
-                    QueryErrorType::kStatefulFailed, error, 4, query_hash);
+                    QueryErrorType::kStatefulFailed,
+                    error,
+                    4,
+                    query_hash,
+                    snapshot_height);
               }
               // if paging hash is not specified, we should check, why 0
               // transactions are returned - it can be because there are
@@ -537,7 +560,8 @@ namespace iroha {
                     QueryErrorType::kStatefulFailed,
                     query_incorrect.error_message,
                     query_incorrect.error_code,
-                    query_hash);
+                    query_hash,
+                    snapshot_height);
               }
             }
 
@@ -549,11 +573,19 @@ namespace iroha {
               auto next_hash = response_txs.back()->hash();
               response_txs.pop_back();
               return query_response_factory_->createTransactionsPageResponse(
-                  std::move(response_txs), next_hash, total_size, query_hash);
+                  std::move(response_txs),
+                  next_hash,
+                  total_size,
+                  query_hash,
+                  snapshot_height);
             }
 
             return query_response_factory_->createTransactionsPageResponse(
-                std::move(response_txs), std::nullopt, total_size, query_hash);
+                std::move(response_txs),
+                std::nullopt,
+                total_size,
+                query_hash,
+                snapshot_height);
           },
           notEnoughPermissionsResponse(perm_converter_, perms...));
     }
@@ -561,7 +593,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAccount &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       using QueryTuple =
           QueryType<shared_model::interface::types::AccountIdType,
                     shared_model::interface::types::DomainIdType,
@@ -588,17 +621,23 @@ namespace iroha {
                                                Role::kGetAllAccounts,
                                                Role::kGetDomainAccounts));
 
-      auto query_apply = [this, &query_hash](auto &account_id,
-                                             auto &domain_id,
-                                             auto &quorum,
-                                             auto &data,
-                                             auto &roles_str) {
+      auto query_apply = [this, &query_hash, snapshot_height](
+                             auto &account_id,
+                             auto &domain_id,
+                             auto &quorum,
+                             auto &data,
+                             auto &roles_str) {
         std::vector<shared_model::interface::types::RoleIdType> roles;
         auto roles_str_no_brackets = roles_str.substr(1, roles_str.size() - 2);
         boost::split(
             roles, roles_str_no_brackets, [](char c) { return c == ','; });
-        return query_response_factory_->createAccountResponse(
-            account_id, domain_id, quorum, data, std::move(roles), query_hash);
+        return query_response_factory_->createAccountResponse(account_id,
+                                                              domain_id,
+                                                              quorum,
+                                                              data,
+                                                              std::move(roles),
+                                                              query_hash,
+                                                              snapshot_height);
       };
 
       return executeQuery<QueryTuple, PermissionTuple>(
@@ -607,11 +646,16 @@ namespace iroha {
                     soci::use(q.accountId(), "target_account_id"));
           },
           query_hash,
-          [this, &q, &query_apply, &query_hash](auto range, auto &) {
+          snapshot_height,
+          [this, &q, &query_apply, &query_hash, snapshot_height](auto range,
+                                                                 auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
-              return this->logAndReturnErrorResponse(
-                  QueryErrorType::kNoAccount, q.accountId(), 0, query_hash);
+              return this->logAndReturnErrorResponse(QueryErrorType::kNoAccount,
+                                                     q.accountId(),
+                                                     0,
+                                                     query_hash,
+                                                     snapshot_height);
             }
 
             return iroha::ametsuchi::apply(range_without_nulls.front(),
@@ -626,7 +670,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetBlock &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       if (not hasAccountRolePermission(Role::kGetBlocks, creator_id)) {
         // no permission
         return query_response_factory_->createErrorQueryResponse(
@@ -634,7 +679,8 @@ namespace iroha {
                 kStatefulFailed,
             notEnoughPermissionsResponse(perm_converter_, Role::kGetBlocks)(),
             2,
-            query_hash);
+            query_hash,
+            snapshot_height);
       }
 
       auto ledger_height = block_store_.size();
@@ -646,7 +692,8 @@ namespace iroha {
                 + ") is greater than the ledger's one ("
                 + std::to_string(ledger_height) + ")",
             3,
-            query_hash);
+            query_hash,
+            snapshot_height);
       }
 
       auto block_deserialization_msg = [height = q.height()] {
@@ -659,16 +706,18 @@ namespace iroha {
         return logAndReturnErrorResponse(QueryErrorType::kStatefulFailed,
                                          block_deserialization_msg(),
                                          1,
-                                         query_hash);
+                                         query_hash,
+                                         snapshot_height);
       }
-      return query_response_factory_->createBlockResponse(std::move(*block),
-                                                          query_hash);
+      return query_response_factory_->createBlockResponse(
+          std::move(*block), query_hash, snapshot_height);
     }
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetSignatories &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       using QueryTuple = QueryType<std::string>;
       using PermissionTuple = boost::tuple<int>;
 
@@ -690,11 +739,16 @@ namespace iroha {
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] { return (sql_.prepare << cmd, soci::use(q.accountId())); },
           query_hash,
-          [this, &q, &query_hash](auto range, auto &) {
+          snapshot_height,
+          [this, &q, &query_hash, snapshot_height](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
               return this->logAndReturnErrorResponse(
-                  QueryErrorType::kNoSignatories, q.accountId(), 0, query_hash);
+                  QueryErrorType::kNoSignatories,
+                  q.accountId(),
+                  0,
+                  query_hash,
+                  snapshot_height);
             }
 
             auto pubkeys = boost::copy_range<std::vector<std::string>>(
@@ -703,7 +757,7 @@ namespace iroha {
                 }));
 
             return query_response_factory_->createSignatoriesResponse(
-                pubkeys, query_hash);
+                pubkeys, query_hash, snapshot_height);
           },
           notEnoughPermissionsResponse(perm_converter_,
                                        Role::kGetMySignatories,
@@ -714,7 +768,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAccountTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       char const *related_txs = R"(
           creator_id = :account_id
           AND asset_id IS NULL
@@ -752,6 +807,7 @@ namespace iroha {
       return executeTransactionsQuery(q,
                                       creator_id,
                                       query_hash,
+                                      snapshot_height,
                                       std::move(check_query),
                                       related_txs,
                                       apply_query,
@@ -763,7 +819,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       std::string hash_str = boost::algorithm::join(
           q.transactionHashes()
               | boost::adaptors::transformed(
@@ -793,6 +850,7 @@ namespace iroha {
             return (sql_.prepare << cmd, soci::use(creator_id, "account_id"));
           },
           query_hash,
+          snapshot_height,
           [&](auto range, auto &my_perm, auto &all_perm) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (boost::size(range_without_nulls)
@@ -805,7 +863,8 @@ namespace iroha {
                   QueryErrorType::kStatefulFailed,
                   "At least one of the supplied hashes is incorrect",
                   4,
-                  query_hash);
+                  query_hash,
+                  snapshot_height);
             }
             std::map<uint64_t, std::unordered_set<std::string>> index;
             for (const auto &t : range_without_nulls) {
@@ -831,12 +890,16 @@ namespace iroha {
                   std::back_inserter(response_txs));
               if (auto e = iroha::expected::resultToOptionalError(txs_result)) {
                 return this->logAndReturnErrorResponse(
-                    QueryErrorType::kStatefulFailed, e.value(), 1, query_hash);
+                    QueryErrorType::kStatefulFailed,
+                    e.value(),
+                    1,
+                    query_hash,
+                    snapshot_height);
               }
             }
 
             return query_response_factory_->createTransactionsResponse(
-                std::move(response_txs), query_hash);
+                std::move(response_txs), query_hash, snapshot_height);
           },
           notEnoughPermissionsResponse(
               perm_converter_, Role::kGetMyTxs, Role::kGetAllTxs));
@@ -845,7 +908,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAccountAssetTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       char const *related_txs = R"(
           creator_id = :account_id
           AND asset_id = :asset_id
@@ -891,6 +955,7 @@ namespace iroha {
       return executeTransactionsQuery(q,
                                       creator_id,
                                       query_hash,
+                                      snapshot_height,
                                       std::move(check_query),
                                       related_txs,
                                       apply_query,
@@ -902,7 +967,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAccountAssets &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       using QueryTuple =
           QueryType<shared_model::interface::types::AccountIdType,
                     shared_model::interface::types::AssetIdType,
@@ -910,43 +976,46 @@ namespace iroha {
                     size_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      // get the assets
+      // get the assets. The page is found by the primary key starting from
+      // the first requested asset, and the total number is taken from the
+      // per-account counter, so every page costs the same
       auto cmd = fmt::format(R"(
       with {},
-      all_data as (
-          select row_number() over () rn, *
-          from (
-              select *
-              from account_has_asset
-              where account_id = :account_id
-              order by asset_id
-          ) t
+      page_start as (
+          select asset_id
+          from account_has_asset
+          where account_id = :account_id
+              and asset_id = :first_asset_id
       ),
       total_number as (
-          select rn total_number
-          from all_data
-          order by rn desc
-          limit 1
-      ),
-      page_start as (
-          select rn
-          from all_data
-          where coalesce(asset_id = :first_asset_id, true)
-          limit 1
+          select coalesce(
+              (
+                  select asset_count
+                  from account_has_asset_count
+                  where account_id = :account_id
+              ),
+              0
+          ) total_number
       ),
       page_data as (
-          select * from all_data, page_start, total_number
-          where
-              all_data.rn >= page_start.rn and
-              coalesce( -- TODO remove after pagination is mandatory IR-516
-                  all_data.rn < page_start.rn + :page_size,
-                  true
-              )
+          select * from (
+              select account_id, asset_id, amount
+              from account_has_asset
+              where account_id = :account_id
+                  and coalesce(
+                      asset_id >= (select asset_id from page_start),
+                      cast(:first_asset_id as text) is null
+                  )
+              order by asset_id
+              limit :page_size -- TODO remove null after pagination is
+                               -- mandatory IR-516
+          ) t, total_number
       )
       select account_id, asset_id, amount, total_number, perm
           from
               page_data
               right join has_perms on true
+          order by asset_id
       )",
                              hasQueryPermissionTarget(creator_id,
                                                       q.accountId(),
@@ -975,6 +1044,7 @@ namespace iroha {
                     soci::use(req_page_size, "page_size"));
           },
           query_hash,
+          snapshot_height,
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             std::vector<
@@ -1003,7 +1073,8 @@ namespace iroha {
                   QueryErrorType::kStatefulFailed,
                   q.accountId(),
                   4,
-                  query_hash);
+                  query_hash,
+                  snapshot_height);
             }
             assert(total_number >= assets.size());
             const bool is_last_page = not q.paginationMeta()
@@ -1016,7 +1087,11 @@ namespace iroha {
               assert(assets.size() == q.paginationMeta()->get().pageSize());
             }
             return query_response_factory_->createAccountAssetResponse(
-                assets, total_number, next_asset_id, query_hash);
+                assets,
+                total_number,
+                next_asset_id,
+                query_hash,
+                snapshot_height);
           },
           notEnoughPermissionsResponse(perm_converter_,
                                        Role::kGetMyAccAst,
@@ -1027,7 +1102,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAccountDetail &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       using QueryTuple =
           QueryType<shared_model::interface::types::DetailType,
                     uint32_t,
@@ -1145,6 +1221,7 @@ namespace iroha {
                     soci::use(page_size, "page_size"));
           },
           query_hash,
+          snapshot_height,
           [&, this](auto range, auto &) {
             if (range.empty()) {
               assert(not range.empty());
@@ -1153,7 +1230,8 @@ namespace iroha {
                   QueryErrorType::kNoAccountDetail,
                   q.accountId(),
                   0,
-                  query_hash);
+                  query_hash,
+                  snapshot_height);
             }
 
             return iroha::ametsuchi::apply(
@@ -1170,7 +1248,8 @@ namespace iroha {
                         QueryErrorType::kNoAccountDetail,
                         q.accountId(),
                         0,
-                        query_hash);
+                        query_hash,
+                        snapshot_height);
                   }
                   assert(target_account_exists.value() == 1);
                   if (json) {
@@ -1211,7 +1290,8 @@ namespace iroha {
                                   const shared_model::interface::
                                       AccountDetailRecordId>>(next_record_id);
                             },
-                        query_hash);
+                        query_hash,
+                        snapshot_height);
                   }
                   if (total_number.value_or(0) > 0) {
                     // the only reason for it is nonexistent first record
@@ -1220,13 +1300,18 @@ namespace iroha {
                         QueryErrorType::kStatefulFailed,
                         q.accountId(),
                         4,
-                        query_hash);
+                        query_hash,
+                        snapshot_height);
                   } else {
                     // no account details matching query
                     // TODO 2019.06.11 mboldyrev IR-558 redesign missing data
                     // handling
                     return query_response_factory_->createAccountDetailResponse(
-                        kEmptyDetailsResponse, 0, std::nullopt, query_hash);
+                        kEmptyDetailsResponse,
+                        0,
+                        std::nullopt,
+                        query_hash,
+                        snapshot_height);
                   }
                 });
           },
@@ -1239,7 +1324,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetRoles &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       using QueryTuple = QueryType<shared_model::interface::types::RoleIdType>;
       using PermissionTuple = boost::tuple<int>;
 
@@ -1256,6 +1342,7 @@ namespace iroha {
                     soci::use(creator_id, "role_account_id"));
           },
           query_hash,
+          snapshot_height,
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             auto roles = boost::copy_range<
@@ -1265,8 +1352,8 @@ namespace iroha {
                       t, [](auto &role_id) { return role_id; });
                 }));
 
-            return query_response_factory_->createRolesResponse(roles,
-                                                                query_hash);
+            return query_response_factory_->createRolesResponse(
+                roles, query_hash, snapshot_height);
           },
           notEnoughPermissionsResponse(perm_converter_, Role::kGetRoles));
     }
@@ -1274,7 +1361,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetRolePermissions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       using QueryTuple = QueryType<std::string>;
       using PermissionTuple = boost::tuple<int>;
 
@@ -1294,22 +1382,26 @@ namespace iroha {
                     soci::use(q.roleId(), "role_name"));
           },
           query_hash,
-          [this, &q, &creator_id, &query_hash](auto range, auto &) {
+          snapshot_height,
+          [this, &q, &creator_id, &query_hash, snapshot_height](auto range,
+                                                                auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
               return this->logAndReturnErrorResponse(
                   QueryErrorType::kNoRoles,
                   "{" + q.roleId() + ", " + creator_id + "}",
                   0,
-                  query_hash);
+                  query_hash,
+                  snapshot_height);
             }
 
             return iroha::ametsuchi::apply(
                 range_without_nulls.front(),
-                [this, &query_hash](auto &permission) {
+                [this, &query_hash, snapshot_height](auto &permission) {
                   return query_response_factory_->createRolePermissionsResponse(
                       shared_model::interface::RolePermissionSet(permission),
-                      query_hash);
+                      query_hash,
+                      snapshot_height);
                 });
           },
           notEnoughPermissionsResponse(perm_converter_, Role::kGetRoles));
@@ -1318,7 +1410,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAssetInfo &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       using QueryTuple =
           QueryType<shared_model::interface::types::DomainIdType, uint32_t>;
       using PermissionTuple = boost::tuple<int>;
@@ -1339,21 +1432,29 @@ namespace iroha {
                     soci::use(q.assetId(), "asset_id"));
           },
           query_hash,
-          [this, &q, &creator_id, &query_hash](auto range, auto &) {
+          snapshot_height,
+          [this, &q, &creator_id, &query_hash, snapshot_height](auto range,
+                                                                auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
               return this->logAndReturnErrorResponse(
                   QueryErrorType::kNoAsset,
                   "{" + q.assetId() + ", " + creator_id + "}",
                   0,
-                  query_hash);
+                  query_hash,
+                  snapshot_height);
             }
 
             return iroha::ametsuchi::apply(
                 range_without_nulls.front(),
-                [this, &q, &query_hash](auto &domain_id, auto &precision) {
+                [this, &q, &query_hash, snapshot_height](auto &domain_id,
+                                                         auto &precision) {
                   return query_response_factory_->createAssetResponse(
-                      q.assetId(), domain_id, precision, query_hash);
+                      q.assetId(),
+                      domain_id,
+                      precision,
+                      query_hash,
+                      snapshot_height);
                 });
           },
           notEnoughPermissionsResponse(perm_converter_, Role::kReadAssets));
@@ -1362,7 +1463,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetPendingTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       std::vector<std::unique_ptr<shared_model::interface::Transaction>>
           response_txs;
       if (q.paginationMeta()) {
@@ -1371,7 +1473,8 @@ namespace iroha {
                                      q.paginationMeta()->get().pageSize(),
                                      q.paginationMeta()->get().firstTxHash())
             .match(
-                [this, &response_txs, &query_hash](auto &&response) {
+                [this, &response_txs, &query_hash, snapshot_height](
+                    auto &&response) {
                   auto &interface_txs = response.value.transactions;
                   response_txs.reserve(interface_txs.size());
                   // TODO igor-egorov 2019-06-06 IR-555 avoid use of clone()
@@ -1384,9 +1487,10 @@ namespace iroha {
                           std::move(response_txs),
                           response.value.all_transactions_size,
                           std::move(response.value.next_batch_info),
-                          query_hash);
+                          query_hash,
+                          snapshot_height);
                 },
-                [this, &q, &query_hash](auto &&error) {
+                [this, &q, &query_hash, snapshot_height](auto &&error) {
                   switch (error.error) {
                     case iroha::PendingTransactionStorage::ErrorCode::kNotFound:
                       return query_response_factory_->createErrorQueryResponse(
@@ -1399,7 +1503,8 @@ namespace iroha {
                                     .firstTxHash()
                                     ->toString(),
                           4,  // missing first tx hash error
-                          query_hash);
+                          query_hash,
+                          snapshot_height);
                     default:
                       BOOST_ASSERT_MSG(false,
                                        "Unknown and unhandled type of error "
@@ -1410,7 +1515,8 @@ namespace iroha {
                           std::string("Unknown type of error happened: ")
                               + std::to_string(error.error),
                           1,  // unknown internal error
-                          query_hash);
+                          query_hash,
+                          snapshot_height);
                   }
                 });
       } else {  // TODO 2019-06-06 igor-egorov IR-516 remove deprecated
@@ -1424,14 +1530,15 @@ namespace iroha {
                        std::back_inserter(response_txs),
                        [](auto &tx) { return clone(*tx); });
         return query_response_factory_->createTransactionsResponse(
-            std::move(response_txs), query_hash);
+            std::move(response_txs), query_hash, snapshot_height);
       }
     }
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetPeers &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       using QueryTuple = QueryType<std::string,
                                    shared_model::interface::types::AddressType,
                                    std::string>;
@@ -1450,6 +1557,7 @@ namespace iroha {
                     soci::use(creator_id, "role_account_id"));
           },
           query_hash,
+          snapshot_height,
           [&](auto range, auto &) {
             shared_model::interface::types::PeerList peers;
             for (const auto &row : range) {
@@ -1469,8 +1577,8 @@ namespace iroha {
                     }
                   });
             }
-            return query_response_factory_->createPeersResponse(peers,
-                                                                query_hash);
+            return query_response_factory_->createPeersResponse(
+                peers, query_hash, snapshot_height);
           },
           notEnoughPermissionsResponse(perm_converter_, Role::kGetPeers));
     }
@@ -1478,7 +1586,8 @@ namespace iroha {
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetEngineReceipts &q,
         const shared_model::interface::types::AccountIdType &creator_id,
-        const shared_model::interface::types::HashType &query_hash) {
+        const shared_model::interface::types::HashType &query_hash,
+        shared_model::interface::types::HeightType snapshot_height) {
       auto cmd = fmt::format(
           R"(
             with
@@ -1530,6 +1639,7 @@ namespace iroha {
             return (sql_.prepare << cmd, soci::use(q.txHash(), "tx_hash"));
           },
           query_hash,
+          snapshot_height,
           [&](auto range, auto &) {
             using RecordsCollection = std::vector<
                 std::unique_ptr<shared_model::interface::EngineReceipt>>;
@@ -1620,7 +1730,7 @@ namespace iroha {
             store_record(records, std::move(record));
 
             return query_response_factory_->createEngineReceiptsResponse(
-                records, query_hash);
+                records, query_hash, snapshot_height);
           },
           notEnoughPermissionsResponse(perm_converter_,
                                        Role::kGetMyEngineReceipts,
@@ -61,7 +61,8 @@ namespace iroha {
           logger::LoggerPtr log);
 
       QueryExecutorResult execute(
-          const shared_model::interface::Query &qry) override;
+          const shared_model::interface::Query &qry,
+          shared_model::interface::types::HeightType snapshot_height) override;
 
       bool hasAccountRolePermission(
           shared_model::interface::permissions::Role permission,
@@ -70,72 +71,86 @@ namespace iroha {
       QueryExecutorResult operator()(
           const shared_model::interface::GetAccount &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetBlock &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetSignatories &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetAccountTransactions &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetTransactions &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetAccountAssetTransactions &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetAccountAssets &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetAccountDetail &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetRoles &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetRolePermissions &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetAssetInfo &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetPendingTransactions &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetPeers &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
       QueryExecutorResult operator()(
           const shared_model::interface::GetEngineReceipts &q,
           const shared_model::interface::types::AccountIdType &creator_id,
-          const shared_model::interface::types::HashType &query_hash);
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height);
 
      private:
       /**
@@ -160,6 +175,7 @@ namespace iroha {
        * response in case something wrong with permissions
        * @param query_executor - function, executing query
        * @param query_hash - hash of query
+       * @param snapshot_height - height of the ledger state the query sees
        * @param response_creator - function, creating query response
        * @param perms_err_response - function, creating error response
        * @return query response created as a result of query execution
@@ -172,6 +188,7 @@ namespace iroha {
       QueryExecutorResult executeQuery(
           QueryExecutor &&query_executor,
           const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height,
           ResponseCreator &&response_creator,
           PermissionsErrResponse &&perms_err_response);
 
@@ -181,6 +198,7 @@ namespace iroha {
        * @param error_body - stringified error of the query
        * @param error_code of the query
        * @param query_hash - hash of query
+       * @param snapshot_height - height of the ledger state the query sees
        * @return ptr to created error response
        */
       std::unique_ptr<shared_model::interface::QueryResponse>
@@ -188,7 +206,8 @@ namespace iroha {
           iroha::ametsuchi::QueryErrorType error_type,
           QueryErrorMessageType error_body,
           QueryErrorCodeType error_code,
-          const shared_model::interface::types::HashType &query_hash) const;
+          const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height) const;
 
       /**
        * Execute query which returns list of transactions
@@ -196,6 +215,7 @@ namespace iroha {
        * @param query - query object
        * @param creator_id - query creator account id
        * @param query_hash - hash of query
+       * @param snapshot_height - height of the ledger state the query sees
        * @param qry_checker - fallback checker of the query, needed if paging
        * hash is not specified and 0 transaction are returned as a query result
        * @param related_txs - SQL query which returns transaction relevant
@@ -213,6 +233,7 @@ namespace iroha {
           const Query &query,
           const shared_model::interface::types::AccountIdType &creator_id,
           const shared_model::interface::types::HashType &query_hash,
+          shared_model::interface::types::HeightType snapshot_height,
           QueryChecker &&qry_checker,
           char const *related_txs,
           QueryApplier applier,
@@ -224,10 +224,16 @@ namespace iroha {
         const shared_model::interface::AccountAsset &asset) {
       auto balance = asset.balance().toStringRepr();
       soci::statement st = sql_.prepare
-          << "INSERT INTO account_has_asset(account_id, asset_id, amount) "
+          << "WITH inserted AS ("
+             "INSERT INTO account_has_asset(account_id, asset_id, amount) "
              "VALUES (:account_id, :asset_id, :amount) ON CONFLICT "
              "(account_id, asset_id) DO UPDATE SET "
-             "amount = EXCLUDED.amount";
+             "amount = EXCLUDED.amount "
+             "RETURNING account_id, (xmax = 0) AS is_new) "
+             "INSERT INTO account_has_asset_count(account_id, asset_count) "
+             "SELECT account_id, 1 FROM inserted WHERE is_new "
+             "ON CONFLICT (account_id) DO UPDATE SET "
+             "asset_count = account_has_asset_count.asset_count + 1";
 
       st.exchange(soci::use(asset.accountId()));
       st.exchange(soci::use(asset.assetId()));
@@ -6,6 +6,10 @@
 #ifndef IROHA_POSTGRES_WSV_COMMON_HPP
 #define IROHA_POSTGRES_WSV_COMMON_HPP
 
+#include <ciso646>
+#include <string>
+#include <vector>
+
 #include <soci/soci.h>
 #include <boost/optional.hpp>
 #include <boost/range/adaptor/filtered.hpp>
@@ -17,6 +21,30 @@
 namespace iroha {
   namespace ametsuchi {
 
+    /**
+     * Make a PostgreSQL array literal, e.g. {"a","b"}, of the values, so that
+     * a list is bound as a single parameter, e.g. unnest(:values::text[])
+     */
+    inline std::string makePostgresArray(
+        const std::vector<std::string> &values) {
+      std::string array{"{"};
+      for (const auto &value : values) {
+        if (array.size() > 1) {
+          array += ',';
+        }
+        array += '"';
+        for (auto c : value) {
+          if (c == '"' or c == '\\') {
+            array += '\\';
+          }
+          array += c;
+        }
+        array += '"';
+      }
+      array += '}';
+      return array;
+    }
+
     template <typename ParamType, typename Function>
     inline void processSoci(soci::statement &st,
                             soci::indicator &ind,
@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 
+#include <chrono>
 #include <utility>
 
 #include <soci/callbacks.h>
@@ -13,6 +14,9 @@
 #include <boost/format.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
 #include <boost/tuple/tuple.hpp>
+#include "ametsuchi/impl/background_block_indexer.hpp"
+#include "ametsuchi/impl/indexed_height.hpp"
+#include "ametsuchi/impl/ledger_peers.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
@@ -57,10 +61,13 @@ namespace iroha {
         std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
         size_t pool_size,
         std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        std::shared_ptr<PoolWrapper> query_pool_wrapper,
+        bool background_indexing)
         : block_store_(std::move(block_store)),
           pool_wrapper_(std::move(pool_wrapper)),
           connection_(pool_wrapper_->connection_pool_),
+          query_pool_wrapper_(std::move(query_pool_wrapper)),
           notifier_(notifier_lifetime_),
           perm_converter_(std::move(perm_converter)),
           pending_txs_storage_(std::move(pending_txs_storage)),
@@ -75,7 +82,32 @@ namespace iroha {
               pool_wrapper_->enable_prepared_transactions_),
           block_is_prepared_(false),
           prepared_block_name_(postgres_options.preparedBlockName()),
-          ledger_state_(std::move(ledger_state)) {}
+          ledger_state_(std::move(ledger_state)) {
+      const auto committed_height =
+          ledger_state_ ? ledger_state_.value()->top_block_info.height : 0;
+      auto indexer_log =
+          log_manager_->getChild("BackgroundBlockIndexer")->getLogger();
+      if (background_indexing) {
+        indexed_height_ = std::make_shared<IndexedHeight>();
+        block_indexer_ = std::make_unique<BackgroundBlockIndexer>(
+            std::make_unique<soci::session>(*connection_),
+            block_store_,
+            indexed_height_,
+            notifier_.get_observable(),
+            committed_height,
+            std::move(indexer_log));
+      } else {
+        // the blocks left unindexed by a previous run with background
+        // indexing are indexed before the commits write positions above them
+        soci::session sql(*connection_);
+        if (not BackgroundBlockIndexer::indexMissing(
+                sql, *block_store_, committed_height, indexer_log)) {
+          log_->error(
+              "Transaction positions of some committed blocks are not "
+              "written, transaction queries may miss them");
+        }
+      }
+    }
 
     std::unique_ptr<TemporaryWsv> StorageImpl::createTemporaryWsv(
         std::shared_ptr<CommandExecutor> command_executor) {
@@ -90,7 +122,8 @@ namespace iroha {
       tryRollback(postgres_command_executor->getSession());
       return std::make_unique<TemporaryWsvImpl>(
           std::move(postgres_command_executor),
-          log_manager_->getChild("TemporaryWorldStateView"));
+          log_manager_->getChild("TemporaryWorldStateView"),
+          connection_);
     }
 
     std::unique_ptr<MutableStorage> StorageImpl::createMutableStorage(
@@ -127,7 +160,11 @@ namespace iroha {
       if (not connection_) {
         return "createQueryExecutor: connection to database is not initialised";
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
+      // client queries do not compete with block processing for connections
+      // when they have their own pool
+      auto sql = std::make_unique<soci::session>(
+          query_pool_wrapper_ ? *query_pool_wrapper_->connection_pool_
+                              : *connection_);
       auto log_manager = log_manager_->getChild("QueryExecutor");
       return std::make_unique<PostgresQueryExecutor>(
           std::move(sql),
@@ -139,7 +176,8 @@ namespace iroha {
               response_factory,
               perm_converter_,
               log_manager->getChild("SpecificQueryExecutor")->getLogger()),
-          log_manager->getLogger());
+          log_manager->getLogger(),
+          indexed_height_);
     }
 
     bool StorageImpl::insertBlock(
@@ -204,7 +242,9 @@ namespace iroha {
           ledger_state_,
           std::move(postgres_command_executor),
           storage_factory.create(),
-          log_manager_->getChild("MutableStorageImpl"));
+          log_manager_->getChild("MutableStorageImpl"),
+          block_indexer_ ? PostgresBlockIndex::Tables::kTxStatuses
+                         : PostgresBlockIndex::Tables::kAll);
     }
 
     void StorageImpl::resetPeers() {
@@ -231,6 +271,8 @@ namespace iroha {
         log_->warn("Tried to free connections without active connection");
         return;
       }
+      // the indexer holds a connection of the pool
+      block_indexer_.reset();
       // rollback possible prepared transaction
       {
         soci::session sql(*connection_);
@@ -244,6 +286,7 @@ namespace iroha {
       }
       sessions.clear();
       connection_.reset();
+      query_pool_wrapper_.reset();
     }
 
     expected::Result<std::shared_ptr<StorageImpl>, std::string>
@@ -259,7 +302,9 @@ namespace iroha {
         std::shared_ptr<BlockStorage> persistent_block_storage,
         std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
         logger::LoggerManagerTreePtr log_manager,
-        size_t pool_size) {
+        size_t pool_size,
+        std::shared_ptr<PoolWrapper> query_pool_wrapper,
+        bool background_indexing) {
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state;
       {
         soci::session sql{*pool_wrapper->connection_pool_};
@@ -291,21 +336,74 @@ namespace iroha {
                           std::move(temporary_block_storage_factory),
                           pool_size,
                           std::move(vm_caller_ref),
-                          std::move(log_manager))));
+                          std::move(log_manager),
+                          std::move(query_pool_wrapper),
+                          background_indexing)));
     }
 
     CommitResult StorageImpl::commit(
         std::unique_ptr<MutableStorage> mutable_storage) {
-      return std::move(*mutable_storage).commit() |
-                 [this](auto commit_result) -> CommitResult {
-        commit_result.block_storage->forEach(
-            [this](const auto &block) { this->storeBlock(block); });
+      if (block_store_error_) {
+        return expected::makeError(*block_store_error_);
+      }
+
+      using Clock = std::chrono::steady_clock;
+      const auto start = Clock::now();
 
+      return std::move(*mutable_storage).commit() |
+                 [this, start](auto commit_result) -> CommitResult {
+        // blocks are written only after their WSV transaction is committed,
+        // so that the block storage is never ahead of WSV at runtime
         ledger_state_ = commit_result.ledger_state;
+        const auto wsv_committed = Clock::now();
+
+        size_t written = 0;
+        boost::optional<std::string> store_error;
+        commit_result.block_storage->forEach([&](const auto &block) {
+          if (store_error) {
+            return;
+          }
+          if (auto error =
+                  expected::resultToOptionalError(this->storeBlock(block))) {
+            store_error =
+                *error + " at height " + std::to_string(block->height());
+            return;
+          }
+          ++written;
+        });
+
+        auto to_ms = [](auto duration) {
+          return std::chrono::duration<double, std::milli>(duration).count();
+        };
+        log_->debug("Committed {} blocks: WSV in {:.2f} ms, block storage in "
+                    "{:.2f} ms",
+                    written,
+                    to_ms(wsv_committed - start),
+                    to_ms(Clock::now() - wsv_committed));
+
+        if (store_error) {
+          return this->blockStoreBehindWsv(
+              *store_error, commit_result.ledger_state->top_block_info.height);
+        }
         return expected::makeValue(std::move(commit_result.ledger_state));
       };
     }
 
+    CommitResult StorageImpl::blockStoreBehindWsv(
+        const std::string &store_error,
+        shared_model::interface::types::HeightType wsv_height) {
+      // WSV cannot be rolled back after its commit, and committing more blocks
+      // on top of it would only widen the gap, so no more blocks are committed
+      // until the node is restarted. WsvRestorerImpl reports WSV being ahead
+      // of the block storage then
+      block_store_error_ = fmt::format(
+          "Block storage is behind WSV: {}, WSV is committed up to height {}",
+          store_error,
+          wsv_height);
+      log_->critical("{}", *block_store_error_);
+      return expected::makeError(*block_store_error_);
+    }
+
     bool StorageImpl::preparedCommitEnabled() const {
       return prepared_blocks_enabled_ and block_is_prepared_;
     }
@@ -321,6 +419,10 @@ namespace iroha {
         return expected::makeError("there are no prepared blocks");
       }
 
+      if (block_store_error_) {
+        return expected::makeError(*block_store_error_);
+      }
+
       log_->info("applying prepared block");
 
       try {
@@ -334,7 +436,9 @@ namespace iroha {
         sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
         PostgresBlockIndex block_index(
             std::make_unique<PostgresIndexer>(sql),
-            log_manager_->getChild("BlockIndex")->getLogger());
+            log_manager_->getChild("BlockIndex")->getLogger(),
+            block_indexer_ ? PostgresBlockIndex::Tables::kTxStatuses
+                           : PostgresBlockIndex::Tables::kAll);
         block_index.index(*block);
         block_is_prepared_ = false;
 
@@ -344,23 +448,25 @@ namespace iroha {
           throw std::runtime_error(e.value());
         }
 
-        return storeBlock(block) | [this, &sql, &block]() -> CommitResult {
-          decltype(
-              std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
-          {
-            auto peer_query = PostgresWsvQuery(
-                sql, this->log_manager_->getChild("WsvQuery")->getLogger());
-            if (not(opt_ledger_peers = peer_query.getPeers())) {
-              return expected::makeError(
-                  std::string{"Failed to get ledger peers! Will retry."});
-            }
-          }
-          assert(opt_ledger_peers);
+        if (auto error = expected::resultToOptionalError(storeBlock(block))) {
+          return blockStoreBehindWsv(*error, block->height());
+        }
 
-          ledger_state_ = std::make_shared<const LedgerState>(
-              std::move(*opt_ledger_peers), block->height(), block->hash());
-          return expected::makeValue(ledger_state_.value());
-        };
+        auto opt_ledger_peers =
+            getLedgerPeers(*block, ledger_state_, [this, &sql] {
+              return PostgresWsvQuery(
+                         sql,
+                         this->log_manager_->getChild("WsvQuery")->getLogger())
+                  .getPeers();
+            });
+        if (not opt_ledger_peers) {
+          return expected::makeError(
+              std::string{"Failed to get ledger peers! Will retry."});
+        }
+
+        ledger_state_ = std::make_shared<const LedgerState>(
+            std::move(*opt_ledger_peers), block->height(), block->hash());
+        return expected::makeValue(ledger_state_.value());
       } catch (const std::exception &e) {
         std::string msg((boost::format("failed to apply prepared block %s: %s")
                          % block->hash().hex() % e.what())
@@ -35,6 +35,8 @@ namespace iroha {
   namespace ametsuchi {
 
     class AmetsuchiTest;
+    class BackgroundBlockIndexer;
+    class IndexedHeight;
     class PostgresOptions;
     class VmCaller;
 
@@ -52,7 +54,9 @@ namespace iroha {
           std::shared_ptr<BlockStorage> persistent_block_storage,
           std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
           logger::LoggerManagerTreePtr log_manager,
-          size_t pool_size = 10);
+          size_t pool_size = 10,
+          std::shared_ptr<PoolWrapper> query_pool_wrapper = nullptr,
+          bool background_indexing = false);
 
       expected::Result<std::unique_ptr<CommandExecutor>, std::string>
       createCommandExecutor() override;
@@ -131,7 +135,9 @@ namespace iroha {
           std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
           size_t pool_size,
           std::optional<std::reference_wrapper<const VmCaller>> vm_caller,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          std::shared_ptr<PoolWrapper> query_pool_wrapper,
+          bool background_indexing);
 
      private:
       using StoreBlockResult = iroha::expected::Result<void, std::string>;
@@ -144,6 +150,17 @@ namespace iroha {
       StoreBlockResult storeBlock(
           std::shared_ptr<const shared_model::interface::Block> block);
 
+      /**
+       * Stop committing blocks after committed blocks could not be written to
+       * the block storage
+       * @param store_error - error of the block storage
+       * @param wsv_height - height WSV is committed up to
+       * @return error of the commit
+       */
+      CommitResult blockStoreBehindWsv(
+          const std::string &store_error,
+          shared_model::interface::types::HeightType wsv_height);
+
       /**
        * Method tries to perform rollback on passed session
        */
@@ -156,6 +173,10 @@ namespace iroha {
       /// ref for pool_wrapper_::connection_pool_
       std::shared_ptr<soci::connection_pool> &connection_;
 
+      /// separate connections for client queries, none if they share the
+      /// connections with block processing
+      std::shared_ptr<PoolWrapper> query_pool_wrapper_;
+
       rxcpp::composite_subscription notifier_lifetime_;
       rxcpp::subjects::subject<
           std::shared_ptr<const shared_model::interface::Block>>
@@ -187,6 +208,16 @@ namespace iroha {
       std::string prepared_block_name_;
 
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state_;
+
+      /// set when WSV is committed further than the block storage, after which
+      /// commits are refused
+      boost::optional<std::string> block_store_error_;
+
+      /// watermark of transaction positions, none if they are written with
+      /// the commit
+      std::shared_ptr<IndexedHeight> indexed_height_;
+
+      std::unique_ptr<BackgroundBlockIndexer> block_indexer_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -5,10 +5,9 @@
 
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 
-#include <boost/algorithm/string/join.hpp>
-#include <boost/format.hpp>
-#include <boost/range/adaptor/transformed.hpp>
+#include <soci/boost-tuple.h>
 #include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/soci_utils.hpp"
 #include "ametsuchi/tx_executor.hpp"
 #include "interfaces/commands/command.hpp"
 #include "interfaces/permission_to_string.hpp"
@@ -16,65 +15,216 @@
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 
+namespace {
+  /**
+   * Signature check of a transaction, prepared once for the temporary WSV.
+   * There is a row per signatory key with the matching signatory of the
+   * creator, if any.
+   */
+  const std::string kValidateSignatures = R"(
+      SELECT count(signatory.public_key) = :signatures_count
+             AND (SELECT quorum
+                  FROM account
+                  WHERE account_id = :account_id) <= :signatures_count
+      FROM unnest(:public_keys::text[]) AS keys(public_key)
+      LEFT JOIN account_has_signatory AS signatory
+          ON signatory.account_id = :account_id
+          AND signatory.public_key = lower(keys.public_key))";
+
+  /**
+   * Signature check of several transactions, the same as the one of
+   * validateSignatures for each of them. There is a row per signature with
+   * the index of its transaction, the creator, the number of signatures of
+   * the transaction and the signatory key.
+   */
+  const std::string kCheckSignatures = R"(
+      SELECT checks.idx,
+             CASE WHEN count(signatory.public_key) = max(checks.count)
+                       AND max(account.quorum) <= max(checks.count)
+                  THEN 1 ELSE 0 END
+      FROM unnest(:indexes::bigint[],
+                  :account_ids::text[],
+                  :counts::bigint[],
+                  :public_keys::text[])
+          AS checks(idx, account_id, count, public_key)
+      LEFT JOIN account_has_signatory AS signatory
+          ON signatory.account_id = checks.account_id
+          AND signatory.public_key = lower(checks.public_key)
+      LEFT JOIN account ON account.account_id = checks.account_id
+      GROUP BY checks.idx)";
+}  // namespace
+
 namespace iroha {
   namespace ametsuchi {
     TemporaryWsvImpl::TemporaryWsvImpl(
         std::shared_ptr<PostgresCommandExecutor> command_executor,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        std::shared_ptr<soci::connection_pool> connection_pool)
         : sql_(command_executor->getSession()),
+          connection_pool_(std::move(connection_pool)),
           transaction_executor_(std::make_unique<TransactionExecutor>(
               std::move(command_executor))),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()) {
-      sql_ << "BEGIN";
+      // a single snapshot for the whole proposal, which is shared with the
+      // check of prevalidateSignatures
+      sql_ << "BEGIN ISOLATION LEVEL REPEATABLE READ";
     }
 
     expected::Result<void, validation::CommandError>
     TemporaryWsvImpl::validateSignatures(
         const shared_model::interface::Transaction &transaction) {
-      auto keys_range = transaction.signatures()
-          | boost::adaptors::transformed(
-                            [](const auto &s) { return s.publicKey(); });
-      auto keys = boost::algorithm::join(keys_range, "'), ('");
+      std::vector<std::string> keys;
+      for (const auto &signature : transaction.signatures()) {
+        keys.emplace_back(signature.publicKey());
+      }
+      const auto public_keys = makePostgresArray(keys);
+      const size_t signatures_count = keys.size();
       // not using bool since it is not supported by SOCI
       boost::optional<uint8_t> signatories_valid;
 
-      boost::format query(R"(SELECT sum(count) = :signatures_count
-                          AND sum(quorum) <= :signatures_count
-                  FROM
-                      (SELECT count(public_key)
-                      FROM ( VALUES ('%s') ) AS CTE1(public_key)
-                      WHERE lower(public_key) IN
-                          (SELECT public_key
-                          FROM account_has_signatory
-                          WHERE account_id = :account_id ) ) AS CTE2(count),
-                          (SELECT quorum
-                          FROM account
-                          WHERE account_id = :account_id) AS CTE3(quorum))");
-
       try {
-        auto keys_range_size = boost::size(keys_range);
-        sql_ << (query % keys).str(), soci::into(signatories_valid),
-            soci::use(keys_range_size, "signatures_count"),
-            soci::use(transaction.creatorAccountId(), "account_id");
+        if (not signatures_statement_) {
+          signatures_statement_ = std::make_unique<soci::statement>(
+              sql_.prepare << kValidateSignatures);
+        }
+        auto &statement = *signatures_statement_;
+        try {
+          statement.exchange(soci::into(signatories_valid));
+          statement.exchange(soci::use(public_keys, "public_keys"));
+          statement.exchange(soci::use(signatures_count, "signatures_count"));
+          statement.exchange(
+              soci::use(transaction.creatorAccountId(), "account_id"));
+          statement.define_and_bind();
+          statement.execute(true);
+          statement.bind_clean_up();
+        } catch (...) {
+          statement.bind_clean_up();
+          throw;
+        }
       } catch (const std::exception &e) {
-        auto error_str = "Transaction " + transaction.toString()
-            + " failed signatures validation with db error: " + e.what();
-        // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
-        // with named constant
-        return expected::makeError(validation::CommandError{
-            "signatures validation", 1, error_str, false});
+        return signaturesDbError(transaction, e.what());
       }
 
       if (signatories_valid and *signatories_valid) {
         return {};
       } else {
-        auto error_str = "Transaction " + transaction.toString()
-            + " failed signatures validation";
-        // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
-        // with named constant
-        return expected::makeError(validation::CommandError{
-            "signatures validation", 2, error_str, false});
+        return signaturesError(transaction);
+      }
+    }
+
+    expected::Result<void, validation::CommandError>
+    TemporaryWsvImpl::signaturesDbError(
+        const shared_model::interface::Transaction &transaction,
+        const std::string &reason) {
+      auto error_str = "Transaction " + transaction.toString()
+          + " failed signatures validation with db error: " + reason;
+      // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
+      // with named constant
+      return expected::makeError(validation::CommandError{
+          "signatures validation", 1, error_str, false});
+    }
+
+    expected::Result<void, validation::CommandError>
+    TemporaryWsvImpl::signaturesError(
+        const shared_model::interface::Transaction &transaction) {
+      auto error_str = "Transaction " + transaction.toString()
+          + " failed signatures validation";
+      // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
+      // with named constant
+      return expected::makeError(validation::CommandError{
+          "signatures validation", 2, error_str, false});
+    }
+
+    void TemporaryWsvImpl::prevalidateSignatures(
+        const std::vector<std::reference_wrapper<
+            const shared_model::interface::Transaction>> &transactions) {
+      waitPrevalidation();
+      prevalidated_indexes_.clear();
+      prevalidation_results_.clear();
+      prevalidation_error_ = boost::none;
+      if (transactions.empty() or not connection_pool_) {
+        return;
+      }
+
+      size_t position = 0;
+      if (not connection_pool_->try_lease(position, 0)) {
+        // the signatures will be checked one by one in apply()
+        log_->debug("No free connection to check signatures in advance");
+        return;
+      }
+      std::shared_ptr<soci::session> session(
+          &connection_pool_->at(position),
+          [pool = connection_pool_, position](soci::session *) {
+            pool->give_back(position);
+          });
+
+      // the leased connection must see the same committed state as apply(),
+      // so the snapshot of the temporary WSV is imported there. It is taken
+      // before any transaction is applied and is kept while the transaction
+      // of the temporary WSV is open, which outlives the check
+      std::string snapshot;
+      try {
+        sql_ << "SELECT pg_export_snapshot()", soci::into(snapshot);
+      } catch (const std::exception &e) {
+        log_->warn("Failed to export the snapshot of the temporary WSV: {}",
+                   e.what());
+        return;
+      }
+
+      std::vector<std::string> indexes, account_ids, counts, public_keys;
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        const auto &tx = transactions[i].get();
+        const auto signatures_count =
+            std::to_string(boost::size(tx.signatures()));
+        for (const auto &signature : tx.signatures()) {
+          indexes.push_back(std::to_string(i));
+          account_ids.push_back(tx.creatorAccountId());
+          counts.push_back(signatures_count);
+          public_keys.emplace_back(signature.publicKey());
+        }
+        prevalidated_indexes_.emplace(tx.hash(), i);
+      }
+
+      prevalidation_ = std::async(
+          std::launch::async,
+          [session = std::move(session),
+           snapshot = std::move(snapshot),
+           transactions_count = transactions.size(),
+           indexes = makePostgresArray(indexes),
+           account_ids = makePostgresArray(account_ids),
+           counts = makePostgresArray(counts),
+           public_keys = makePostgresArray(public_keys)] {
+            std::vector<bool> results(transactions_count, false);
+            *session << "BEGIN ISOLATION LEVEL REPEATABLE READ READ ONLY";
+            try {
+              *session << "SET TRANSACTION SNAPSHOT '" + snapshot + "'";
+              soci::rowset<boost::tuple<size_t, int>> rowset =
+                  (session->prepare << kCheckSignatures,
+                   soci::use(indexes, "indexes"),
+                   soci::use(account_ids, "account_ids"),
+                   soci::use(counts, "counts"),
+                   soci::use(public_keys, "public_keys"));
+              for (const auto &row : rowset) {
+                results.at(row.get<0>()) = row.get<1>() != 0;
+              }
+            } catch (...) {
+              *session << "ROLLBACK";
+              throw;
+            }
+            *session << "ROLLBACK";
+            return results;
+          });
+    }
+
+    void TemporaryWsvImpl::waitPrevalidation() {
+      if (not prevalidation_.valid()) {
+        return;
+      }
+      try {
+        prevalidation_results_ = prevalidation_.get();
+      } catch (const std::exception &e) {
+        prevalidation_error_ = std::string{e.what()};
       }
     }
 
@@ -82,7 +232,25 @@ namespace iroha {
         const shared_model::interface::Transaction &transaction) {
       auto savepoint_wrapper = createSavepoint("savepoint_temp_wsv");
 
-      return validateSignatures(transaction) |
+      auto validate_signatures = [this, &transaction]()
+          -> expected::Result<void, validation::CommandError> {
+        auto prevalidated = prevalidated_indexes_.find(transaction.hash());
+        if (prevalidated == prevalidated_indexes_.end()) {
+          return validateSignatures(transaction);
+        }
+        auto index = prevalidated->second;
+        prevalidated_indexes_.erase(prevalidated);
+        waitPrevalidation();
+        if (prevalidation_error_) {
+          return signaturesDbError(transaction, *prevalidation_error_);
+        }
+        if (prevalidation_results_.at(index)) {
+          return {};
+        }
+        return signaturesError(transaction);
+      };
+
+      return validate_signatures() |
                  [this,
                   savepoint = std::move(savepoint_wrapper),
                   &transaction]()
@@ -112,6 +280,7 @@ namespace iroha {
     }
 
     TemporaryWsvImpl::~TemporaryWsvImpl() {
+      waitPrevalidation();
       try {
         sql_ << "ROLLBACK";
       } catch (std::exception &e) {
@@ -8,8 +8,15 @@
 
 #include "ametsuchi/temporary_wsv.hpp"
 
+#include <future>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include <soci/soci.h>
+#include <boost/optional.hpp>
 #include "ametsuchi/command_executor.hpp"
+#include "cryptography/hash.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
 
@@ -45,13 +52,26 @@ namespace iroha {
         logger::LoggerPtr log_;
       };
 
+      /**
+       * @param command_executor - executor with the session of the state
+       * @param log_manager - log manager
+       * @param connection_pool - pool to lease a connection from, on which the
+       * signatures are checked in advance while transactions are applied. No
+       * signatures are checked in advance if it is not set
+       */
       TemporaryWsvImpl(
           std::shared_ptr<PostgresCommandExecutor> command_executor,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          std::shared_ptr<soci::connection_pool> connection_pool = nullptr);
 
       expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) override;
 
+      void prevalidateSignatures(
+          const std::vector<std::reference_wrapper<
+              const shared_model::interface::Transaction>> &transactions)
+          override;
+
       std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
           const std::string &name) override;
 
@@ -60,13 +80,39 @@ namespace iroha {
      private:
       /**
        * Verifies whether transaction has at least quorum signatures and they
-       * are a subset of creator account signatories
+       * are a subset of creator account signatories. The statement of the
+       * check is prepared on the first call and reused for the rest of the
+       * transactions, so that it is parsed and planned once per proposal
        */
       expected::Result<void, validation::CommandError> validateSignatures(
           const shared_model::interface::Transaction &transaction);
 
+      /// Make the error of signatures validation failure
+      expected::Result<void, validation::CommandError> signaturesError(
+          const shared_model::interface::Transaction &transaction);
+
+      /// Make the error of a database failure during signatures validation
+      expected::Result<void, validation::CommandError> signaturesDbError(
+          const shared_model::interface::Transaction &transaction,
+          const std::string &reason);
+
+      /// Wait for the check started by prevalidateSignatures, if any
+      void waitPrevalidation();
+
       soci::session &sql_;
+      std::shared_ptr<soci::connection_pool> connection_pool_;
+      /// indexes of transactions in the results of prevalidateSignatures
+      std::unordered_map<shared_model::crypto::Hash,
+                         size_t,
+                         shared_model::crypto::Hash::Hasher>
+          prevalidated_indexes_;
+      /// check of prevalidateSignatures running on a leased connection
+      std::future<std::vector<bool>> prevalidation_;
+      std::vector<bool> prevalidation_results_;
+      boost::optional<std::string> prevalidation_error_;
       std::unique_ptr<TransactionExecutor> transaction_executor_;
+      /// prepared statement of validateSignatures, released before the session
+      std::unique_ptr<soci::statement> signatures_statement_;
 
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
@@ -8,6 +8,7 @@
 
 #include <functional>
 
+#include <boost/optional.hpp>
 #include <rxcpp/rx-observable-fwd.hpp>
 #include "ametsuchi/block_storage.hpp"
 #include "ametsuchi/ledger_state.hpp"
@@ -68,6 +69,14 @@ namespace iroha {
               blocks,
           MutableStoragePredicate predicate) = 0;
 
+      /**
+       * @return the state of ledger after the last applied block, or the
+       * initial state if no blocks were applied. None if the initial state
+       * was not provided
+       */
+      virtual boost::optional<std::shared_ptr<const iroha::LedgerState>>
+      getLedgerState() const = 0;
+
       /// Apply the local changes made to this MutableStorage to the global WSV.
       virtual expected::Result<MutableStorage::CommitResult, std::string>
       commit() && = 0;
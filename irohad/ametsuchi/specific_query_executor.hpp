@@ -31,8 +31,16 @@ namespace iroha {
      public:
       virtual ~SpecificQueryExecutor() = default;
 
+      /**
+       * Execute the query
+       * @param qry - the query
+       * @param snapshot_height - height of the ledger state the query sees,
+       * which is reported in the response, 0 if unknown
+       * @return response of the query
+       */
       virtual QueryExecutorResult execute(
-          const shared_model::interface::Query &qry) = 0;
+          const shared_model::interface::Query &qry,
+          shared_model::interface::types::HeightType snapshot_height) = 0;
 
       virtual bool hasAccountRolePermission(
           shared_model::interface::permissions::Role permission,
@@ -7,6 +7,7 @@
 #define IROHA_TEMPORARYWSV_HPP
 
 #include <functional>
+#include <vector>
 
 #include "common/result.hpp"
 #include "validation/stateful_validator_common.hpp"
@@ -47,6 +48,19 @@ namespace iroha {
       virtual expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) = 0;
 
+      /**
+       * Check signatures of several transactions against the committed state
+       * at once, before any transaction is applied. The check may run in
+       * parallel with apply() of other transactions, and apply() of these
+       * transactions reuses its results instead of checking the signatures on
+       * its own, so no transaction applied before them may change signatories
+       * or quorum of their creators
+       * @param transactions - transactions to check
+       */
+      virtual void prevalidateSignatures(
+          const std::vector<std::reference_wrapper<
+              const shared_model::interface::Transaction>> &transactions) = 0;
+
       /**
        * Create a savepoint for wsv state
        * @param name of savepoint to be created
@@ -25,6 +25,7 @@ namespace iroha {
 
       boost::optional<Answer> YacBlockStorage::insert(VoteMessage msg) {
         if (validScheme(msg) and uniqueVote(msg)) {
+          signer_votes_.emplace(msg.signature->publicKey(), votes_.size());
           votes_.push_back(msg);
 
           log_->info(
@@ -65,7 +66,8 @@ namespace iroha {
       }
 
       bool YacBlockStorage::isContains(const VoteMessage &msg) const {
-        return std::count(votes_.begin(), votes_.end(), msg) != 0;
+        auto it = signer_votes_.find(msg.signature->publicKey());
+        return it != signer_votes_.end() and votes_[it->second] == msg;
       }
 
       YacHash YacBlockStorage::getStorageKey() const {
@@ -75,10 +77,7 @@ namespace iroha {
       // --------| private api |--------
 
       bool YacBlockStorage::uniqueVote(VoteMessage &msg) {
-        // lookup take O(n) times
-        return std::all_of(votes_.begin(), votes_.end(), [&msg](auto vote) {
-          return vote != msg;
-        });
+        return signer_votes_.count(msg.signature->publicKey()) == 0;
       }
 
       bool YacBlockStorage::validScheme(VoteMessage &vote) {
@@ -17,21 +17,18 @@ namespace iroha {
 
       // --------| private api |--------
 
-      auto YacProposalStorage::findStore(const YacHash &store_hash) {
+      YacBlockStorage &YacProposalStorage::findStore(
+          const YacHash &store_hash) {
         // find exist
-        auto iter = std::find_if(block_storages_.begin(),
-                                 block_storages_.end(),
-                                 [&store_hash](auto block_storage) {
-                                   auto storage_key =
-                                       block_storage.getStorageKey();
-                                   return storage_key == store_hash;
-                                 });
-        if (iter != block_storages_.end()) {
-          return iter;
+        auto inserted = block_storage_indices_.emplace(
+            std::make_pair(store_hash.vote_hashes.proposal_hash,
+                           store_hash.vote_hashes.block_hash),
+            block_storages_.size());
+        if (not inserted.second) {
+          return block_storages_[inserted.first->second];
         }
         // insert and return new
-        return block_storages_.emplace(
-            block_storages_.end(),
+        return block_storages_.emplace_back(
             YacHash(store_hash.vote_round,
                     store_hash.vote_hashes.proposal_hash,
                     store_hash.vote_hashes.block_hash),
@@ -63,8 +60,7 @@ namespace iroha {
                      msg.hash.vote_hashes.proposal_hash,
                      msg.hash.vote_hashes.block_hash);
 
-          auto iter = findStore(msg.hash);
-          auto block_state = iter->insert(msg);
+          auto block_state = findStore(msg.hash).insert(msg);
 
           // Single BlockStorage always returns CommitMessage because it
           // aggregates votes for a single hash.
@@ -111,14 +107,10 @@ namespace iroha {
       }
 
       bool YacProposalStorage::checkPeerUniqueness(const VoteMessage &msg) {
-        return std::all_of(block_storages_.begin(),
-                           block_storages_.end(),
-                           [&msg](YacBlockStorage &storage) {
-                             if (storage.getStorageKey() != msg.hash) {
-                               return true;
-                             }
-                             return not storage.isContains(msg);
-                           });
+        auto it = block_storage_indices_.find(std::make_pair(
+            msg.hash.vote_hashes.proposal_hash, msg.hash.vote_hashes.block_hash));
+        return it == block_storage_indices_.end()
+            or not block_storages_[it->second].isContains(msg);
       }
 
       boost::optional<Answer> YacProposalStorage::findRejectProof() {
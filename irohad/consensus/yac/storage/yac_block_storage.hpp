@@ -7,6 +7,8 @@
 #define IROHA_YAC_BLOCK_VOTE_STORAGE_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -31,6 +33,11 @@ namespace iroha {
          */
         std::vector<VoteMessage> votes_;
 
+        /**
+         * Index of the vote in votes_ by public key of its signer
+         */
+        std::unordered_map<std::string, size_t> signer_votes_;
+
        public:
         YacBlockStorage(
             YacHash hash,
@@ -85,9 +92,9 @@ namespace iroha {
         // --------| private api |--------
 
         /**
-         * Verify uniqueness of vote in storage
+         * Verify that the signer of the vote has not voted in storage yet
          * @param msg - vote for verification
-         * @return true if vote doesn't appear in storage
+         * @return true if vote of the signer doesn't appear in storage
          */
         bool uniqueVote(VoteMessage &vote);
 
@@ -7,8 +7,12 @@
 #define IROHA_YAC_PROPOSAL_STORAGE_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <boost/functional/hash.hpp>
 #include <boost/optional.hpp>
 #include "consensus/yac/storage/storage_result.hpp"
 #include "consensus/yac/storage/yac_block_storage.hpp"
@@ -36,9 +40,9 @@ namespace iroha {
          * Find block index with provided parameters,
          * if those store absent - create new
          * @param store_hash - hash of store of interest
-         * @return iterator to storage
+         * @return block storage
          */
-        auto findStore(const YacHash &store_hash);
+        YacBlockStorage &findStore(const YacHash &store_hash);
 
        public:
         // --------| public api |--------
@@ -119,6 +123,15 @@ namespace iroha {
          */
         std::vector<YacBlockStorage> block_storages_;
 
+        /**
+         * Index of the block storage in block_storages_ by proposal and block
+         * hashes, all storages are of the same round
+         */
+        std::unordered_map<std::pair<std::string, std::string>,
+                           size_t,
+                           boost::hash<std::pair<std::string, std::string>>>
+            block_storage_indices_;
+
         /**
          * Key of the storage
          */
@@ -56,7 +56,7 @@ namespace iroha {
           *pb_vote = PbConverters::serializeVote(vote);
         }
 
-        async_call_->Call([&](auto context, auto cq) {
+        async_call_->CallPeer(to.address(), [&](auto context, auto cq) {
           return peers_.at(to.address())->AsyncSendState(context, request, cq);
         });
 
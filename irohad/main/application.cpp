@@ -8,6 +8,7 @@
 #include <optional>
 
 #include <boost/filesystem.hpp>
+#include <boost/range/size.hpp>
 #include <rxcpp/operators/rx-concat.hpp>
 #include <rxcpp/operators/rx-flat_map.hpp>
 #include <rxcpp/operators/rx-map.hpp>
@@ -98,6 +99,9 @@ static constexpr iroha::consensus::yac::ConsistencyModel
 /// Database connection pool size. Limits the number of similtaneous accesses.
 static constexpr int kDbPoolSize = 10;
 
+/// Size of the separate connection pool for client queries, unless configured.
+static constexpr int kDbQueryPoolSize = 5;
+
 /**
  * Configuring iroha daemon
  */
@@ -121,7 +125,12 @@ Irohad::Irohad(
     const boost::optional<GossipPropagationStrategyParams>
         &opt_mst_gossip_params,
     const boost::optional<iroha::torii::TlsParams> &torii_tls_params,
-    boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config)
+    boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config,
+    boost::optional<IrohadConfig::NetworkClient> network_client_config,
+    boost::optional<IrohadConfig::BlockCompression> block_compression_config,
+    boost::optional<IrohadConfig::DbConfig::QueryPool> query_pool_config,
+    bool background_indexing,
+    boost::optional<IrohadConfig::AdaptiveProposal> adaptive_proposal_config)
     : block_store_dir_(block_store_dir),
       listen_ip_(listen_ip),
       torii_port_(torii_port),
@@ -137,6 +146,13 @@ Irohad::Irohad(
       opt_alternative_peers_(std::move(opt_alternative_peers)),
       opt_mst_gossip_params_(opt_mst_gossip_params),
       inter_peer_tls_config_(std::move(inter_peer_tls_config)),
+      network_client_config_(
+          network_client_config.value_or(IrohadConfig::NetworkClient{})),
+      block_compression_config_(block_compression_config.value_or(
+          IrohadConfig::BlockCompression{})),
+      query_pool_config_(std::move(query_pool_config)),
+      background_indexing_(background_indexing),
+      adaptive_proposal_config_(std::move(adaptive_proposal_config)),
       pending_txs_storage_init(
           std::make_unique<PendingTransactionStorageInit>()),
       keypair(keypair),
@@ -189,13 +205,13 @@ Irohad::RunResult Irohad::init() {
   | [this]{ return initPeerCertProvider();}
   | [this]{ return initCryptoProvider();}
   | [this]{ return initBatchParser();}
+  | [this]{ return initConsensusCache();}
   | [this]{ return initValidators();}
   | [this]{ return initNetworkClient();}
   | [this]{ return initFactories();}
   | [this]{ return initPersistentCache();}
   | [this]{ return initOrderingGate();}
   | [this]{ return initSimulator();}
-  | [this]{ return initConsensusCache();}
   | [this]{ return initBlockLoader();}
   | [this]{ return initConsensusGate();}
   | [this]{ return initSynchronizer();}
@@ -270,8 +286,22 @@ Irohad::RunResult Irohad::initStorage(
                    kDbPoolSize,
                    log_manager_);
              }
-             | [this](auto &&pool_wrapper) -> RunResult {
-    pool_wrapper_ = std::move(pool_wrapper);
+             | [this](auto &&pool_wrapper) {
+                 pool_wrapper_ = std::move(pool_wrapper);
+                 return PgConnectionInit::prepareConnectionPool(
+                     iroha::ametsuchi::KTimesReconnectionStrategyFactory{10},
+                     query_pool_config_
+                         ? PostgresOptions(*pg_opt_,
+                                           query_pool_config_->host,
+                                           query_pool_config_->port)
+                         : *pg_opt_,
+                     query_pool_config_ ? query_pool_config_->size
+                                        : kDbQueryPoolSize,
+                     log_manager_->getChild("QueryPool"),
+                     false);
+               }
+             | [this](auto &&query_pool_wrapper) -> RunResult {
+    query_pool_wrapper_ = std::move(query_pool_wrapper);
     query_response_factory_ =
         std::make_shared<shared_model::proto::ProtoQueryResponseFactory>();
     auto perm_converter =
@@ -300,13 +330,26 @@ Irohad::RunResult Irohad::initStorage(
         return expected::makeError(
             "Unable to create FlatFile for persistent storage");
       }
+      // the compressor is created even with compression off to read the
+      // blocks stored compressed before
+      auto compressor = BlockCompressor::create(
+          (boost::filesystem::path{*block_store_dir_}
+           / FlatFileBlockStorage::kDictionariesDir)
+              .string(),
+          block_compression_config_.store,
+          log_manager_->getChild("BlockCompressor")->getLogger());
+      if (not compressor) {
+        return expected::makeError(
+            "Unable to create block compressor for persistent storage");
+      }
       std::shared_ptr<shared_model::interface::BlockJsonConverter>
           block_converter =
               std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
       persistent_block_storage = std::make_unique<FlatFileBlockStorage>(
           std::move(flat_file.get()),
           block_converter,
-          log_manager_->getChild("FlatFileBlockStorage")->getLogger());
+          log_manager_->getChild("FlatFileBlockStorage")->getLogger(),
+          std::move(compressor.get()));
     } else {
       auto sql =
           std::make_unique<soci::session>(*pool_wrapper_->connection_pool_);
@@ -333,7 +376,10 @@ Irohad::RunResult Irohad::initStorage(
                                std::move(temporary_block_storage_factory),
                                std::move(persistent_block_storage),
                                vm_caller_ref,
-                               log_manager_->getChild("Storage"))
+                               log_manager_->getChild("Storage"),
+                               kDbPoolSize,
+                               query_pool_wrapper_,
+                               background_indexing_)
                | [&](auto &&v) -> RunResult {
       storage = std::move(v);
       finalized_txs_ =
@@ -495,6 +541,7 @@ Irohad::RunResult Irohad::initValidators() {
       validators_log_manager->getChild("Stateful")->getLogger());
   chain_validator = std::make_shared<ChainValidatorImpl>(
       getSupermajorityChecker(kConsensusConsistencyModel),
+      consensus_result_cache_,
       validators_log_manager->getChild("Chain")->getLogger());
 
   log_->info("[Init] => validators");
@@ -507,7 +554,9 @@ Irohad::RunResult Irohad::initValidators() {
 Irohad::RunResult Irohad::initNetworkClient() {
   async_call_ =
       std::make_shared<network::AsyncGrpcClient<google::protobuf::Empty>>(
-          log_manager_->getChild("AsyncNetworkClient")->getLogger());
+          log_manager_->getChild("AsyncNetworkClient")->getLogger(),
+          network_client_config_.completion_queues,
+          network_client_config_.max_in_flight_per_peer);
   return {};
 }
 
@@ -640,6 +689,21 @@ Irohad::RunResult Irohad::initOrderingGate() {
   auto factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
       shared_model::validation::DefaultProposalValidator>>(validators_config_);
 
+  if (adaptive_proposal_config_) {
+    proposal_controller_ =
+        std::make_shared<ordering::AdaptiveProposalController>(
+            ordering::AdaptiveProposalController::Config{
+                adaptive_proposal_config_->min_proposal_size,
+                max_proposal_size_,
+                std::chrono::milliseconds(
+                    adaptive_proposal_config_->target_round_time_ms),
+                std::chrono::milliseconds(
+                    adaptive_proposal_config_->max_round_delay_ms)},
+            log_manager_->getChild("Ordering")
+                ->getChild("ProposalController")
+                ->getLogger());
+  }
+
   const uint64_t kCounter = 0, kMaxLocalCounter = 2;
   // reject_delay and local_counter are local mutable variables of lambda
   const auto kMaxDelay(max_rounds_delay_);
@@ -649,7 +713,9 @@ Irohad::RunResult Irohad::initOrderingGate() {
                 // MSVC requires const variables to be captured
                 kMaxDelay,
                 kMaxDelayIncrement,
-                kMaxLocalCounter](const auto &commit) mutable {
+                kMaxLocalCounter,
+                proposal_controller =
+                    proposal_controller_](const auto &commit) mutable {
     using iroha::synchronizer::SynchronizationOutcomeType;
     if (commit.sync_outcome == SynchronizationOutcomeType::kReject
         or commit.sync_outcome == SynchronizationOutcomeType::kNothing) {
@@ -663,6 +729,9 @@ Irohad::RunResult Irohad::initOrderingGate() {
       }
     } else {
       reject_delay = std::chrono::milliseconds(0);
+      if (proposal_controller) {
+        return proposal_controller->roundDelay();
+      }
     }
     return reject_delay;
   };
@@ -684,6 +753,14 @@ Irohad::RunResult Irohad::initOrderingGate() {
                                      persistent_cache,
                                      proposal_strategy,
                                      delay,
+                                     ordering::BatchForwardingConfig{
+                                         std::chrono::microseconds(
+                                             network_client_config_
+                                                 .batch_forwarding_window_us),
+                                         network_client_config_
+                                             .max_batches_per_request},
+                                     proposal_controller_,
+                                     keypair.publicKey(),
                                      log_manager_->getChild("Ordering"));
   log_->info("[Init] => init ordering gate - [{}]",
              logger::boolRepr(bool(ordering_gate)));
@@ -742,7 +819,8 @@ Irohad::RunResult Irohad::initBlockLoader() {
                                   storage,
                                   consensus_result_cache_,
                                   block_validators_config_,
-                                  log_manager_->getChild("BlockLoader"));
+                                  log_manager_->getChild("BlockLoader"),
+                                  block_compression_config_.transfer);
 
   log_->info("[Init] => block loader");
   return {};
@@ -819,6 +897,26 @@ Irohad::RunResult Irohad::initPeerCommunicationService() {
     log_->info("~~~~~~~~~| PROPOSAL ^_^ |~~~~~~~~~ ");
   });
 
+  if (proposal_controller_) {
+    pcs->onProposal().subscribe(
+        [controller = proposal_controller_](const auto &event) {
+          if (event.proposal) {
+            controller->onProposal(
+                event.round, boost::size((*event.proposal)->transactions()));
+          }
+        });
+    pcs->onVerifiedProposal().subscribe(
+        [controller = proposal_controller_](const auto &event) {
+          if (event.verified_proposal_result) {
+            controller->onVerifiedProposal(event.round);
+          }
+        });
+    storage->on_commit().subscribe(
+        [controller = proposal_controller_](const auto &block) {
+          controller->onCommit(block->height());
+        });
+  }
+
   pcs->onSynchronization().subscribe([this](const auto &event) {
     using iroha::synchronizer::SynchronizationOutcomeType;
     switch (event.sync_outcome) {
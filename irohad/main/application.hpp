@@ -113,6 +113,16 @@ class Irohad {
    * @param torii_tls_params - optional TLS params for torii.
    * @see iroha::torii::TlsParams
    * @param inter_peer_tls_config - set up TLS in peer-to-peer communication
+   * @param network_client_config - optional settings of the asynchronous
+   * client used for consensus, ordering and MST messages
+   * @param block_compression_config - optional compression of stored and
+   * transferred blocks
+   * @param query_pool_config - optional settings of the connections used for
+   * client queries
+   * @param background_indexing - whether transaction positions are written
+   * in background after the commit of a block
+   * @param adaptive_proposal_config - optional adjustment of the proposal
+   * size and of the round delay by the measured round time
    * TODO mboldyrev 03.11.2018 IR-1844 Refactor the constructor.
    */
   Irohad(const boost::optional<std::string> &block_store_dir,
@@ -136,7 +146,16 @@ class Irohad {
          const boost::optional<iroha::torii::TlsParams> &torii_tls_params =
              boost::none,
          boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config =
-             boost::none);
+             boost::none,
+         boost::optional<IrohadConfig::NetworkClient> network_client_config =
+             boost::none,
+         boost::optional<IrohadConfig::BlockCompression>
+             block_compression_config = boost::none,
+         boost::optional<IrohadConfig::DbConfig::QueryPool> query_pool_config =
+             boost::none,
+         bool background_indexing = false,
+         boost::optional<IrohadConfig::AdaptiveProposal>
+             adaptive_proposal_config = boost::none);
 
   /**
    * Initialization of whole objects in system
@@ -243,6 +262,11 @@ class Irohad {
   boost::optional<iroha::GossipPropagationStrategyParams>
       opt_mst_gossip_params_;
   boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config_;
+  IrohadConfig::NetworkClient network_client_config_;
+  IrohadConfig::BlockCompression block_compression_config_;
+  boost::optional<IrohadConfig::DbConfig::QueryPool> query_pool_config_;
+  bool background_indexing_;
+  boost::optional<IrohadConfig::AdaptiveProposal> adaptive_proposal_config_;
 
   boost::optional<std::shared_ptr<const iroha::network::TlsCredentials>>
       my_inter_peer_tls_creds_;
@@ -279,6 +303,7 @@ class Irohad {
   iroha::network::BlockLoaderInit loader_init;
 
   std::shared_ptr<iroha::ametsuchi::PoolWrapper> pool_wrapper_;
+  std::shared_ptr<iroha::ametsuchi::PoolWrapper> query_pool_wrapper_;
 
   // Settings
   std::shared_ptr<const shared_model::validation::Settings> settings_;
@@ -342,6 +367,10 @@ class Irohad {
   // ordering gate
   std::shared_ptr<iroha::network::OrderingGate> ordering_gate;
 
+  // controller of the proposal size, set when it is configured
+  std::shared_ptr<iroha::ordering::AdaptiveProposalController>
+      proposal_controller_;
+
   // simulator
   std::shared_ptr<iroha::simulator::Simulator> simulator;
 
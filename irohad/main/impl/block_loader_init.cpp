@@ -16,11 +16,13 @@ using namespace iroha::network;
 auto BlockLoaderInit::createService(
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
-    const logger::LoggerManagerTreePtr &loader_log_manager) {
+    const logger::LoggerManagerTreePtr &loader_log_manager,
+    bool compress_blocks) {
   return std::make_shared<BlockLoaderService>(
       std::move(block_query_factory),
       std::move(consensus_result_cache),
-      loader_log_manager->getChild("Network")->getLogger());
+      loader_log_manager->getChild("Network")->getLogger(),
+      compress_blocks);
 }
 
 auto BlockLoaderInit::createLoader(
@@ -42,10 +44,12 @@ std::shared_ptr<BlockLoader> BlockLoaderInit::initBlockLoader(
     std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
     std::shared_ptr<shared_model::validation::ValidatorsConfig>
         validators_config,
-    const logger::LoggerManagerTreePtr &loader_log_manager) {
+    const logger::LoggerManagerTreePtr &loader_log_manager,
+    bool compress_blocks) {
   service = createService(std::move(block_query_factory),
                           std::move(consensus_result_cache),
-                          loader_log_manager);
+                          loader_log_manager,
+                          compress_blocks);
   loader = createLoader(std::move(peer_query_factory),
                         std::move(validators_config),
                         loader_log_manager->getLogger());
@@ -26,12 +26,14 @@ namespace iroha {
        * @param block_query_factory - factory to block query component
        * @param block_cache used to retrieve last block put by consensus
        * @param loader_log - the log of the loader subsystem
+       * @param compress_blocks - whether to compress the sent blocks
        * @return initialized service
        */
       auto createService(
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<consensus::ConsensusResultCache> block_cache,
-          const logger::LoggerManagerTreePtr &loader_log_manager);
+          const logger::LoggerManagerTreePtr &loader_log_manager,
+          bool compress_blocks);
 
       /**
        * Create block loader for loading blocks from given peer factory by top
@@ -55,6 +57,8 @@ namespace iroha {
        * @param block_cache used to retrieve last block put by consensus
        * @param validators_config - a config for underlying validators
        * @param loader_log - the log of the loader subsystem
+       * @param compress_blocks - whether to compress the blocks sent to
+       * other peers
        * @return initialized service
        */
       std::shared_ptr<BlockLoader> initBlockLoader(
@@ -64,7 +68,8 @@ namespace iroha {
           std::shared_ptr<consensus::ConsensusResultCache> block_cache,
           std::shared_ptr<shared_model::validation::ValidatorsConfig>
               validators_config,
-          const logger::LoggerManagerTreePtr &loader_log_manager);
+          const logger::LoggerManagerTreePtr &loader_log_manager,
+          bool compress_blocks = false);
 
       std::shared_ptr<BlockLoaderImpl> loader;
       std::shared_ptr<BlockLoaderService> service;
@@ -27,6 +27,7 @@
 #include "ordering/impl/on_demand_ordering_gate.hpp"
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
+#include "ordering/impl/on_demand_os_client_local.hpp"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 #include "ordering/impl/ordering_gate_cache/on_demand_cache.hpp"
 
@@ -53,11 +54,14 @@ namespace iroha {
     }
 
     auto OnDemandOrderingInit::createConnectionManager(
+        std::shared_ptr<ordering::OnDemandOrderingService> ordering_service,
+        const std::string &public_key,
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
         std::vector<shared_model::interface::types::HashType> initial_hashes,
+        ordering::BatchForwardingConfig batch_forwarding,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       // since top block will be the first in commit_notifier observable,
       // hashes of two previous blocks are prepended
@@ -171,12 +175,16 @@ namespace iroha {
                        .map(map_peers);
 
       return std::make_unique<ordering::OnDemandConnectionManager>(
-          createNotificationFactory(std::move(async_call),
-                                    std::move(proposal_transport_factory),
-                                    delay,
-                                    ordering_log_manager),
+          std::make_shared<ordering::transport::OnDemandOsClientLocalFactory>(
+              std::move(ordering_service),
+              public_key,
+              createNotificationFactory(std::move(async_call),
+                                        std::move(proposal_transport_factory),
+                                        delay,
+                                        ordering_log_manager)),
           peers,
-          ordering_log_manager->getChild("ConnectionManager")->getLogger());
+          ordering_log_manager->getChild("ConnectionManager")->getLogger(),
+          batch_forwarding);
     }
 
     auto OnDemandOrderingInit::createGate(
@@ -287,13 +295,17 @@ namespace iroha {
             proposal_factory,
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
         std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+        std::shared_ptr<ordering::AdaptiveProposalController>
+            proposal_controller,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       return std::make_shared<ordering::OnDemandOrderingServiceImpl>(
           max_number_of_transactions,
           std::move(proposal_factory),
           std::move(tx_cache),
           creation_strategy,
-          ordering_log_manager->getChild("Service")->getLogger());
+          ordering_log_manager->getChild("Service")->getLogger(),
+          ordering::OnDemandOrderingServiceImpl::kDefaultNumberOfProposals,
+          std::move(proposal_controller));
     }
 
     OnDemandOrderingInit::~OnDemandOrderingInit() {
@@ -322,11 +334,16 @@ namespace iroha {
         std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
         std::function<std::chrono::milliseconds(
             const synchronizer::SynchronizationEvent &)> delay_func,
+        ordering::BatchForwardingConfig batch_forwarding,
+        std::shared_ptr<ordering::AdaptiveProposalController>
+            proposal_controller,
+        const std::string &public_key,
         logger::LoggerManagerTreePtr ordering_log_manager) {
       auto ordering_service = createService(max_number_of_transactions,
                                             proposal_factory,
                                             tx_cache,
                                             creation_strategy,
+                                            std::move(proposal_controller),
                                             ordering_log_manager);
       service = std::make_shared<ordering::transport::OnDemandOsServerGrpc>(
           ordering_service,
@@ -336,10 +353,13 @@ namespace iroha {
           ordering_log_manager->getChild("Server")->getLogger());
       return createGate(
           ordering_service,
-          createConnectionManager(std::move(async_call),
+          createConnectionManager(ordering_service,
+                                  public_key,
+                                  std::move(async_call),
                                   std::move(proposal_transport_factory),
                                   delay,
                                   std::move(initial_hashes),
+                                  batch_forwarding,
                                   ordering_log_manager),
           std::make_shared<ordering::cache::OnDemandCache>(),
           std::move(proposal_factory),
@@ -16,6 +16,8 @@
 #include "network/ordering_gate.hpp"
 #include "network/peer_communication_service.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/adaptive_proposal_controller.hpp"
+#include "ordering/impl/on_demand_connection_manager.hpp"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
 #include "ordering/on_demand_ordering_service.hpp"
@@ -48,15 +50,19 @@ namespace iroha {
 
       /**
        * Creates connection manager which redirects requests to appropriate
-       * ordering services in the current round. \see initOrderingGate for
-       * parameters
+       * ordering services in the current round. Requests to the ordering
+       * service of this peer are passed to it directly. \see initOrderingGate
+       * for parameters
        */
       auto createConnectionManager(
+          std::shared_ptr<ordering::OnDemandOrderingService> ordering_service,
+          const std::string &public_key,
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes,
+          ordering::BatchForwardingConfig batch_forwarding,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       /**
@@ -86,6 +92,8 @@ namespace iroha {
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+          std::shared_ptr<ordering::AdaptiveProposalController>
+              proposal_controller,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       rxcpp::composite_subscription sync_event_notifier_lifetime_;
@@ -118,6 +126,11 @@ namespace iroha {
        * proposals
        * @param creation_strategy - provides a strategy for creating proposals
        * in OS
+       * @param batch_forwarding - coalescing of the batches sent to ordering
+       * services
+       * @param proposal_controller - optional controller of the size of the
+       * proposals made by the ordering service
+       * @param public_key - public key of this peer
        * @return initialized ordering gate
        */
       std::shared_ptr<network::OrderingGate> initOrderingGate(
@@ -140,6 +153,10 @@ namespace iroha {
           std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
           std::function<std::chrono::milliseconds(
               const synchronizer::SynchronizationEvent &)> delay_func,
+          ordering::BatchForwardingConfig batch_forwarding,
+          std::shared_ptr<ordering::AdaptiveProposalController>
+              proposal_controller,
+          const std::string &public_key,
           logger::LoggerManagerTreePtr ordering_log_manager);
 
       /// gRPC service for ordering service
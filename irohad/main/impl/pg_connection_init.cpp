@@ -48,6 +48,65 @@ namespace {
     return version;
   }
 
+  /**
+   * Change of the tables made without a change of the schema version. A
+   * database created by an earlier build of the same version gets it when it
+   * is reused, while a new database already has it in its tables.
+   */
+  struct SchemaMigration {
+    /// unique name, recorded in schema_migration once the change is made
+    const char *name;
+    /// statements of the change, which also fill the new tables
+    const char *sql;
+  };
+
+  const SchemaMigration kSchemaMigrations[] = {
+      {"account_has_asset_count", R"(
+CREATE TABLE IF NOT EXISTS account_has_asset_count (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    asset_count bigint NOT NULL,
+    PRIMARY KEY (account_id)
+);
+INSERT INTO account_has_asset_count (account_id, asset_count)
+    SELECT account_id, count(*) FROM account_has_asset GROUP BY account_id
+    ON CONFLICT (account_id) DO NOTHING;
+)"}};
+
+  const std::string kSchemaMigrationTableSql = R"(
+CREATE TABLE IF NOT EXISTS schema_migration (
+    name text NOT NULL PRIMARY KEY
+);
+)";
+
+  /**
+   * Make the schema changes missing from the database in one transaction
+   * @param sql a connection to working database
+   * @return error message if a change has failed
+   */
+  iroha::expected::Result<void, std::string> migrateSchema(
+      soci::session &sql) {
+    try {
+      soci::transaction transaction(sql);
+      sql << kSchemaMigrationTableSql;
+      for (const auto &migration : kSchemaMigrations) {
+        const std::string name = migration.name;
+        int applied = 0;
+        sql << "SELECT count(*) FROM schema_migration WHERE name = :name",
+            soci::into(applied), soci::use(name, "name");
+        if (applied == 0) {
+          sql << migration.sql;
+          sql << "INSERT INTO schema_migration (name) VALUES (:name)",
+              soci::use(name, "name");
+        }
+      }
+      transaction.commit();
+    } catch (std::exception &e) {
+      return fmt::format("Schema migration failed: {}",
+                         formatPostgresMessage(e.what()));
+    }
+    return iroha::expected::Value<void>();
+  }
+
   iroha::expected::Result<std::unique_ptr<soci::session>, std::string>
   getMaintenanceSession(const PostgresOptions &postgres_options) {
     try {
@@ -142,7 +201,8 @@ PgConnectionInit::prepareWorkingDatabase(
                  "Either overwrite the ledger or use a compatible binary "
                  "version.";
         }
-        return iroha::expected::Value<void>{};
+        return getWorkingDbSession(options) |
+            [](auto sql) { return migrateSchema(*sql); };
       };
     }
     return dropWorkingDatabase(options) | [&] { return createSchema(options); };
@@ -154,7 +214,8 @@ PgConnectionInit::prepareConnectionPool(
     const ReconnectionStrategyFactory &reconnection_strategy_factory,
     const PostgresOptions &options,
     const int pool_size,
-    logger::LoggerManagerTreePtr log_manager) {
+    logger::LoggerManagerTreePtr log_manager,
+    bool prepared_blocks) {
   auto options_str = options.workingConnectionString();
 
   auto conn = initPostgresConnection(options_str, pool_size);
@@ -166,8 +227,11 @@ PgConnectionInit::prepareConnectionPool(
       boost::get<expected::Value<std::shared_ptr<soci::connection_pool>>>(conn)
           .value;
 
-  soci::session sql(*connection);
-  bool enable_prepared_transactions = preparedTransactionsAvailable(sql);
+  bool enable_prepared_transactions = false;
+  if (prepared_blocks) {
+    soci::session sql(*connection);
+    enable_prepared_transactions = preparedTransactionsAvailable(sql);
+  }
   try {
     auto try_rollback = [&](soci::session &session) {
       if (enable_prepared_transactions) {
@@ -349,6 +413,11 @@ CREATE TABLE account_has_asset (
     amount decimal NOT NULL,
     PRIMARY KEY (account_id, asset_id)
 );
+CREATE TABLE account_has_asset_count (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    asset_count bigint NOT NULL,
+    PRIMARY KEY (account_id)
+);
 CREATE TABLE role_has_permissions (
     role_id character varying(32) NOT NULL REFERENCES role,
     permission bit()"
@@ -436,6 +505,13 @@ CREATE INDEX IF NOT EXISTS burrow_tx_logs_topics_log_idx
     (log_idx ASC);
 )";
   session << prepare_tables_sql;
+  // the tables above already include all schema migrations
+  session << kSchemaMigrationTableSql;
+  for (const auto &migration : kSchemaMigrations) {
+    const std::string name = migration.name;
+    session << "INSERT INTO schema_migration (name) VALUES (:name)",
+        soci::use(name, "name");
+  }
 }
 
 iroha::expected::Result<void, std::string>
@@ -452,7 +528,7 @@ iroha::expected::Result<void, std::string> PgConnectionInit::createSchema(
     return getMaintenanceSession(postgres_options) | [&](auto maintenance_sql) {
       *maintenance_sql << fmt::format("create database {};",
                                       postgres_options.workingDbName());
-      return getWorkingDbSession(postgres_options) | [](auto session)
+      return getWorkingDbSession(postgres_options) | [&](auto session)
                  -> iroha::expected::Result<void, std::string> {
         prepareTables(*session);
         return iroha::expected::Value<void>{};
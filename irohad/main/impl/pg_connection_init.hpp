@@ -34,12 +34,19 @@ namespace iroha {
           StartupWsvDataPolicy startup_wsv_data_policy,
           const PostgresOptions &options);
 
+      /**
+       * Create a pool of connections to the working database
+       * @param prepared_blocks - whether the pool may hold prepared blocks.
+       * A pool without them, like the one for client queries, neither rolls
+       * them back nor checks their support, so its server may be a hot standby
+       */
       static expected::Result<std::shared_ptr<PoolWrapper>, std::string>
       prepareConnectionPool(
           const ReconnectionStrategyFactory &reconnection_strategy_factory,
           const PostgresOptions &options,
           const int pool_size,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          bool prepared_blocks = true);
 
       /**
        * Verify whether postgres supports prepared transactions
@@ -6,7 +6,10 @@
 #include "main/raw_block_loader.hpp"
 
 #include <fstream>
+#include <iterator>
+#include <sstream>
 
+#include <boost/algorithm/string/predicate.hpp>
 #include "backend/protobuf/block.hpp"
 #include "common/bind.hpp"
 #include "common/result.hpp"
@@ -18,13 +21,85 @@ namespace iroha {
     using shared_model::converters::protobuf::jsonToProto;
     using shared_model::interface::Block;
 
-    iroha::expected::Result<std::unique_ptr<Block>, std::string>
-    BlockLoader::parseBlock(const std::string &data) {
+    BlockLoader::BlockResult BlockLoader::parseBlock(const std::string &data) {
       return jsonToProto<iroha::protocol::Block>(data) | [](auto &&block)
                  -> std::unique_ptr<shared_model::interface::Block> {
         return std::make_unique<shared_model::proto::Block>(
-            std::move(block.block_v1()));
+            std::move(*block.mutable_block_v1()));
       };
     }
+
+    BlockLoader::BlockResult BlockLoader::parseBinaryBlock(
+        std::istream &input) {
+      iroha::protocol::Block block;
+      if (not block.ParseFromIstream(&input)) {
+        return iroha::expected::makeError(
+            "Failed to parse binary protobuf block");
+      }
+      return std::make_unique<shared_model::proto::Block>(
+          std::move(*block.mutable_block_v1()));
+    }
+
+    BlockLoader::BlockResult BlockLoader::parseTransactions(
+        std::istream &input) {
+      iroha::protocol::Block_v1 block;
+      auto &payload = *block.mutable_payload();
+      std::string line;
+      size_t line_number = 0;
+      while (std::getline(input, line)) {
+        ++line_number;
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+          continue;
+        }
+        // every line is parsed right into the block, so that only one line
+        // of the file is kept in memory
+        auto status = google::protobuf::util::JsonStringToMessage(
+            line, payload.add_transactions());
+        if (not status.ok()) {
+          return iroha::expected::makeError(
+              "Failed to parse transaction at line "
+              + std::to_string(line_number) + ": " + status.error_message());
+        }
+      }
+      if (input.bad()) {
+        return iroha::expected::makeError("Failed to read transactions");
+      }
+      payload.set_height(1);
+      payload.set_prev_block_hash(std::string(64, '0'));
+      payload.set_tx_number(payload.transactions_size());
+      return std::make_unique<shared_model::proto::Block>(std::move(block));
+    }
+
+    BlockLoader::BlockResult BlockLoader::loadBlock(const std::string &path) {
+      std::ifstream file(path, std::ios::binary);
+      if (not file) {
+        return iroha::expected::makeError("Failed to open file " + path);
+      }
+      if (boost::algorithm::ends_with(path, kTransactionsExtension)) {
+        return parseTransactions(file);
+      }
+      // a binary block starts with the tag of block_v1, which is '\n', so
+      // the whitespaces are skipped only to detect the JSON one
+      if ((file >> std::ws).peek() != '{') {
+        file.clear();
+        file.seekg(0);
+        return parseBinaryBlock(file);
+      }
+      file.seekg(0);
+      std::string data{std::istreambuf_iterator<char>(file),
+                       std::istreambuf_iterator<char>()};
+      auto block = parseBlock(data);
+      if (iroha::expected::hasError(block) and not data.empty()
+          and data.front() == '\n') {
+        // the length of block_v1 may happen to be the code of '{'
+        std::istringstream binary(data);
+        if (auto binary_block = parseBinaryBlock(binary);
+            iroha::expected::hasValue(binary_block)) {
+          return binary_block;
+        }
+      }
+      return block;
+    }
+
   }  // namespace main
 }  // namespace iroha
@@ -26,6 +26,9 @@ namespace config_members {
   const char *Password = "password";
   const char *WorkingDbName = "working database";
   const char *MaintenanceDbName = "maintenance database";
+  const char *QueryPool = "query_pool";
+  const char *QueryPoolSize = "size";
+  const char *BackgroundIndexing = "background_indexing";
   const char *MaxProposalSize = "max_proposal_size";
   const char *ProposalDelay = "proposal_delay";
   const char *VoteDelay = "vote_delay";
@@ -44,9 +47,30 @@ namespace config_members {
       {"warning", logger::LogLevel::kWarn},
       {"error", logger::LogLevel::kError},
       {"critical", logger::LogLevel::kCritical}};
+  const char *LogAsyncSection = "async";
+  const char *LogQueueSize = "queue_size";
+  const char *LogOverflowPolicy = "overflow_policy";
+  const char *LogFlushInterval = "flush_interval";
+  const std::unordered_map<std::string,
+                           logger::AsyncLoggingConfig::OverflowPolicy>
+      LogOverflowPolicies{
+          {"block", logger::AsyncLoggingConfig::OverflowPolicy::kBlock},
+          {"drop", logger::AsyncLoggingConfig::OverflowPolicy::kDrop}};
   const char *Address = "address";
   const char *PublicKey = "public_key";
   const char *InitialPeers = "initial_peers";
   const char *TlsCertificatePath = "tls_certificate_path";
   const char *UtilityService = "utility_service";
+  const char *NetworkClient = "network_client";
+  const char *CompletionQueues = "completion_queues";
+  const char *MaxInFlightPerPeer = "max_in_flight_per_peer";
+  const char *BatchForwardingWindow = "batch_forwarding_window_us";
+  const char *MaxBatchesPerRequest = "max_batches_per_request";
+  const char *BlockCompression = "block_compression";
+  const char *CompressStoredBlocks = "store";
+  const char *CompressTransferredBlocks = "transfer";
+  const char *AdaptiveProposal = "adaptive_proposal";
+  const char *MinProposalSize = "min_proposal_size";
+  const char *TargetRoundTime = "target_round_time_ms";
+  const char *MaxAdaptiveRoundDelay = "max_round_delay_ms";
 }  // namespace config_members
@@ -10,6 +10,7 @@
 #include <unordered_map>
 
 #include "logger/logger.hpp"
+#include "logger/logger_spdlog.hpp"
 
 namespace config_members {
   extern const char *BlockStorePath;
@@ -32,6 +33,9 @@ namespace config_members {
   extern const char *Password;
   extern const char *WorkingDbName;
   extern const char *MaintenanceDbName;
+  extern const char *QueryPool;
+  extern const char *QueryPoolSize;
+  extern const char *BackgroundIndexing;
   extern const char *MaxProposalSize;
   extern const char *ProposalDelay;
   extern const char *VoteDelay;
@@ -44,11 +48,30 @@ namespace config_members {
   extern const char *LogPatternsSection;
   extern const char *LogChildrenSection;
   extern const std::unordered_map<std::string, logger::LogLevel> LogLevels;
+  extern const char *LogAsyncSection;
+  extern const char *LogQueueSize;
+  extern const char *LogOverflowPolicy;
+  extern const char *LogFlushInterval;
+  extern const std::unordered_map<std::string,
+                                  logger::AsyncLoggingConfig::OverflowPolicy>
+      LogOverflowPolicies;
   extern const char *InitialPeers;
   extern const char *Address;
   extern const char *PublicKey;
   extern const char *TlsCertificatePath;
   extern const char *UtilityService;
+  extern const char *NetworkClient;
+  extern const char *CompletionQueues;
+  extern const char *MaxInFlightPerPeer;
+  extern const char *BatchForwardingWindow;
+  extern const char *MaxBatchesPerRequest;
+  extern const char *BlockCompression;
+  extern const char *CompressStoredBlocks;
+  extern const char *CompressTransferredBlocks;
+  extern const char *AdaptiveProposal;
+  extern const char *MinProposalSize;
+  extern const char *TargetRoundTime;
+  extern const char *MaxAdaptiveRoundDelay;
 
 }  // namespace config_members
 
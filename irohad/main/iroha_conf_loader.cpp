@@ -192,6 +192,7 @@ class JsonDeserializerImpl {
                           const rapidjson::Value::ConstObject &obj) {
     tryGetValByKey(path, cfg.log_level, obj, config_members::LogLevel);
     tryGetValByKey(path, cfg.patterns, obj, config_members::LogPatternsSection);
+    tryGetValByKey(path, cfg.async, obj, config_members::LogAsyncSection);
   }
 
   /**
@@ -341,6 +342,38 @@ inline void JsonDeserializerImpl::getVal<logger::LogPatterns>(
   }
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<logger::AsyncLoggingConfig>(
+    const std::string &path,
+    logger::AsyncLoggingConfig &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " async logging config must be an object");
+  const auto obj = src.GetObject();
+  tryGetValByKey(path, dest.queue_size, obj, config_members::LogQueueSize);
+  std::string policy_str;
+  if (tryGetValByKey(
+          path, policy_str, obj, config_members::LogOverflowPolicy)) {
+    const auto it = config_members::LogOverflowPolicies.find(policy_str);
+    if (it == config_members::LogOverflowPolicies.end()) {
+      BOOST_THROW_EXCEPTION(std::runtime_error(
+          "Wrong overflow policy at "
+          + sublevelPath(path, config_members::LogOverflowPolicy)
+          + ": must be one of '"
+          + boost::algorithm::join(config_members::LogOverflowPolicies
+                                       | boost::adaptors::map_keys,
+                                   "', '")
+          + "'."));
+    }
+    dest.overflow_policy = it->second;
+  }
+  uint32_t flush_interval;
+  if (tryGetValByKey(
+          path, flush_interval, obj, config_members::LogFlushInterval)) {
+    dest.flush_interval = std::chrono::seconds{flush_interval};
+  }
+  assert_fatal(dest.queue_size > 0, path + " queue size must be positive");
+}
+
 template <>
 inline void
 JsonDeserializerImpl::getVal<std::unique_ptr<logger::LoggerManagerTree>>(
@@ -441,6 +474,20 @@ JsonDeserializerImpl::getVal<IrohadConfig::InterPeerTls::PeerCertProvider>(
   }
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig::QueryPool>(
+    const std::string &path,
+    IrohadConfig::DbConfig::QueryPool &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(),
+               path + " query pool config top element must be an object.");
+  const auto obj = src.GetObject();
+  tryGetValByKey(path, dest.host, obj, config_members::Host);
+  tryGetValByKey(path, dest.port, obj, config_members::Port);
+  tryGetValByKey(path, dest.size, obj, config_members::QueryPoolSize);
+  assert_fatal(dest.size > 0, path + " query pool size must be positive");
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
     const std::string &path,
@@ -456,6 +503,13 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
   getValByKey(path, dest.working_dbname, obj, config_members::WorkingDbName);
   getValByKey(
       path, dest.maintenance_dbname, obj, config_members::MaintenanceDbName);
+  // the query connections go to the main server unless told otherwise
+  IrohadConfig::DbConfig::QueryPool query_pool{dest.host, dest.port};
+  if (tryGetValByKey(path, query_pool, obj, config_members::QueryPool)) {
+    dest.query_pool = std::move(query_pool);
+  }
+  tryGetValByKey(
+      path, dest.background_indexing, obj, config_members::BackgroundIndexing);
 }
 
 template <>
@@ -470,6 +524,61 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig::UtilityService>(
   getValByKey(path, dest.port, obj, config_members::Port);
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::NetworkClient>(
+    const std::string &path,
+    IrohadConfig::NetworkClient &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(),
+               path + " network client config top element must be an object.");
+  const auto obj = src.GetObject();
+  tryGetValByKey(
+      path, dest.completion_queues, obj, config_members::CompletionQueues);
+  tryGetValByKey(path,
+                 dest.max_in_flight_per_peer,
+                 obj,
+                 config_members::MaxInFlightPerPeer);
+  tryGetValByKey(path,
+                 dest.batch_forwarding_window_us,
+                 obj,
+                 config_members::BatchForwardingWindow);
+  tryGetValByKey(path,
+                 dest.max_batches_per_request,
+                 obj,
+                 config_members::MaxBatchesPerRequest);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::BlockCompression>(
+    const std::string &path,
+    IrohadConfig::BlockCompression &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(),
+               path + " block compression config must be an object.");
+  const auto obj = src.GetObject();
+  tryGetValByKey(path, dest.store, obj, config_members::CompressStoredBlocks);
+  tryGetValByKey(
+      path, dest.transfer, obj, config_members::CompressTransferredBlocks);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::AdaptiveProposal>(
+    const std::string &path,
+    IrohadConfig::AdaptiveProposal &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(),
+               path + " adaptive proposal config must be an object.");
+  const auto obj = src.GetObject();
+  tryGetValByKey(
+      path, dest.min_proposal_size, obj, config_members::MinProposalSize);
+  tryGetValByKey(
+      path, dest.target_round_time_ms, obj, config_members::TargetRoundTime);
+  tryGetValByKey(path,
+                 dest.max_round_delay_ms,
+                 obj,
+                 config_members::MaxAdaptiveRoundDelay);
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<IrohadConfig>(
     const std::string &path, IrohadConfig &dest, const rapidjson::Value &src) {
@@ -499,6 +608,11 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
   getValByKey(path, dest.logger_manager, obj, config_members::LogSection);
   getValByKey(path, dest.initial_peers, obj, config_members::InitialPeers);
   getValByKey(path, dest.utility_service, obj, config_members::UtilityService);
+  getValByKey(path, dest.network_client, obj, config_members::NetworkClient);
+  getValByKey(
+      path, dest.block_compression, obj, config_members::BlockCompression);
+  getValByKey(
+      path, dest.adaptive_proposal, obj, config_members::AdaptiveProposal);
 }
 
 // ------------ end of getVal(path, dst, src) specializations ------------
@@ -17,12 +17,21 @@
 
 struct IrohadConfig {
   struct DbConfig {
+    /// connections for client queries, by default on the same server
+    struct QueryPool {
+      std::string host;
+      uint16_t port;
+      uint32_t size = 5;
+    };
+
     std::string host;
     uint16_t port;
     std::string user;
     std::string password;
     std::string working_dbname;
     std::string maintenance_dbname;
+    boost::optional<QueryPool> query_pool;
+    bool background_indexing = false;
   };
 
   struct InterPeerTls {
@@ -42,6 +51,24 @@ struct IrohadConfig {
     uint16_t port;
   };
 
+  struct NetworkClient {
+    uint32_t completion_queues = 1;
+    uint32_t max_in_flight_per_peer = 0;
+    uint32_t batch_forwarding_window_us = 0;
+    uint32_t max_batches_per_request = 100;
+  };
+
+  struct BlockCompression {
+    bool store = false;
+    bool transfer = false;
+  };
+
+  struct AdaptiveProposal {
+    uint32_t min_proposal_size = 1;
+    uint32_t target_round_time_ms = 3000;
+    uint32_t max_round_delay_ms = 0;
+  };
+
   // TODO: block_store_path is now optional, change docs IR-576
   // luckychess 29.06.2019
   boost::optional<std::string> block_store_path;
@@ -63,6 +90,9 @@ struct IrohadConfig {
   boost::optional<logger::LoggerManagerTreePtr> logger_manager;
   boost::optional<shared_model::interface::types::PeerList> initial_peers;
   boost::optional<UtilityService> utility_service;
+  boost::optional<NetworkClient> network_client;
+  boost::optional<BlockCompression> block_compression;
+  boost::optional<AdaptiveProposal> adaptive_proposal;
 };
 
 /**
@@ -13,7 +13,6 @@
 #include "ametsuchi/storage.hpp"
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
 #include "common/bind.hpp"
-#include "common/files.hpp"
 #include "common/irohad_version.hpp"
 #include "common/result.hpp"
 #include "crypto/keys_manager_impl.hpp"
@@ -72,7 +71,10 @@ DEFINE_validator(config, &validate_config);
 /**
  * Creating input argument for the genesis block file location.
  */
-DEFINE_string(genesis_block, "", "Specify file with initial block");
+DEFINE_string(genesis_block,
+              "",
+              "Specify file with initial block: JSON or binary protobuf "
+              "block, or JSON transactions one per line in a .jsonl file");
 
 /**
  * Creating input argument for the keypair files location.
@@ -158,7 +160,19 @@ getCommonObjectsFactory() {
       shared_model::validation::FieldValidator>>(validators_config);
 }
 
+/**
+ * Writes out the messages of asynchronous loggers when main returns, so that
+ * the ones explaining a startup failure are not lost
+ */
+struct AsyncLoggingGuard {
+  ~AsyncLoggingGuard() {
+    logger::shutdownAsyncLogging();
+  }
+};
+
 int main(int argc, char *argv[]) {
+  AsyncLoggingGuard async_logging_guard;
+
   gflags::SetVersionString(iroha::kGitPrettyVersion);
 
   // Parsing command line arguments
@@ -280,7 +294,13 @@ int main(int argc, char *argv[]) {
       boost::make_optional(config.mst_support,
                            iroha::GossipPropagationStrategyParams{}),
       config.torii_tls_params,
-      boost::none);
+      boost::none,
+      config.network_client,
+      config.block_compression,
+      config.database_config ? config.database_config->query_pool
+                             : boost::none,
+      config.database_config and config.database_config->background_indexing,
+      config.adaptive_proposal);
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad->storage) {
@@ -324,9 +344,7 @@ int main(int argc, char *argv[]) {
           "flag. Restoring existing state.");
     } else {
       auto block_result =
-          iroha::readTextFile(FLAGS_genesis_block) | [](const auto &json) {
-            return iroha::main::BlockLoader::parseBlock(json);
-          };
+          iroha::main::BlockLoader::loadBlock(FLAGS_genesis_block);
 
       if (auto e = iroha::expected::resultToOptionalError(block_result)) {
         log->error("Failed to parse genesis block: {}", e.value());
@@ -6,6 +6,7 @@
 #ifndef IROHA_RAW_BLOCK_INSERTION_HPP
 #define IROHA_RAW_BLOCK_INSERTION_HPP
 
+#include <iosfwd>
 #include <memory>
 #include <string>
 
@@ -27,14 +28,44 @@ namespace iroha {
      */
     class BlockLoader {
      public:
+      using BlockResult = iroha::expected::
+          Result<std::unique_ptr<shared_model::interface::Block>, std::string>;
+
       /**
        * Parse block from JSON string
        * @param data - JSON represenetation of the block
        * @return model Block if operation done successfully, error otherwise
        */
-      static iroha::expected::
-          Result<std::unique_ptr<shared_model::interface::Block>, std::string>
-          parseBlock(const std::string &data);
+      static BlockResult parseBlock(const std::string &data);
+
+      /**
+       * Parse block from binary protobuf stream without reading the whole
+       * stream into memory
+       * @param input - serialized iroha::protocol::Block
+       * @return model Block if operation done successfully, error otherwise
+       */
+      static BlockResult parseBinaryBlock(std::istream &input);
+
+      /**
+       * Make genesis block of transactions read from the stream line by line
+       * @param input - JSON representations of transactions, one per line,
+       * empty lines are skipped
+       * @return unsigned block of height 1 with the transactions in order,
+       * error if a line is not a transaction
+       */
+      static BlockResult parseTransactions(std::istream &input);
+
+      /**
+       * Load block from file. Files with kTransactionsExtension contain
+       * transactions for parseTransactions, other files contain a JSON block
+       * if they start with '{', or a binary protobuf block otherwise
+       * @param path - path to the file
+       * @return model Block if operation done successfully, error otherwise
+       */
+      static BlockResult loadBlock(const std::string &path);
+
+      /// extension of files with a transaction per line
+      static constexpr auto kTransactionsExtension = ".jsonl";
     };
 
   }  // namespace main
@@ -54,9 +54,12 @@ namespace iroha {
 
   bool DefaultCompleter::isExpired(const DataType &batch,
                                    const TimeType &current_time) const {
+    return expirationTime(batch) < current_time;
+  }
+
+  TimeType DefaultCompleter::expirationTime(const DataType &batch) const {
     return oldestTimestamp(batch)
-        + expiration_time_ / std::chrono::milliseconds(1)
-        < current_time;
+        + expiration_time_ / std::chrono::milliseconds(1);
   }
 
   // ------------------------------| public api |-------------------------------
@@ -123,13 +126,27 @@ namespace iroha {
     extractExpiredImpl(current_time, boost::none);
   }
 
-  void MstState::eraseByTransactionHash(
+  boost::optional<DataType> MstState::eraseByTransactionHash(
       const shared_model::interface::types::HashType &hash) {
     auto it = batches_to_hash_.left.find(hash);
-    if (it != batches_to_hash_.left.end()) {
-      batches_.right.erase(it->second);
-      batches_to_hash_.left.erase(it);
+    if (it == batches_to_hash_.left.end()) {
+      return boost::none;
+    }
+    auto batch = it->second;
+    batches_.right.erase(batch);
+    batches_to_hash_.left.erase(it);
+    return batch;
+  }
+
+  boost::optional<DataType> MstState::extractBatch(const DataType &batch) {
+    auto it = batches_.right.find(batch);
+    if (it == batches_.right.end()) {
+      return boost::none;
     }
+    auto found = it->first;
+    batches_to_hash_.right.erase(found);
+    batches_.right.erase(it);
+    return found;
   }
 
   // ------------------------------| private api |------------------------------
@@ -46,6 +46,14 @@ namespace iroha {
     virtual bool isExpired(const DataType &batch,
                            const TimeType &current_time) const = 0;
 
+    /**
+     * Time after which the batch is expired, i.e. isExpired(batch, time) is
+     * true for every time later than the returned one
+     * @param batch - object for validation
+     * @return expiration time of the batch
+     */
+    virtual TimeType expirationTime(const DataType &batch) const = 0;
+
     virtual ~Completer() = default;
   };
 
@@ -67,6 +75,8 @@ namespace iroha {
     bool isExpired(const DataType &tx,
                    const TimeType &current_time) const override;
 
+    TimeType expirationTime(const DataType &batch) const override;
+
    private:
     std::chrono::minutes expiration_time_;
   };
@@ -138,10 +148,18 @@ namespace iroha {
 
     /**
      * Erase batch by transaction hash
+     * @return erased batch, if any
      */
-    void eraseByTransactionHash(
+    boost::optional<DataType> eraseByTransactionHash(
         const shared_model::interface::types::HashType &hash);
 
+    /**
+     * Erase and return the batch equal to the given one
+     * @param batch - batch to be erased
+     * @return batch of the state, if any
+     */
+    boost::optional<DataType> extractBatch(const DataType &batch);
+
     /**
      * Check, if this MST state contains that element
      * @param element to be checked
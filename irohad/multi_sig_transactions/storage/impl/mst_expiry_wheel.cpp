@@ -0,0 +1,186 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "multi_sig_transactions/storage/mst_expiry_wheel.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+
+  MstExpiryWheel::MstExpiryWheel(std::chrono::milliseconds granularity)
+      : granularity_(std::max<uint64_t>(granularity.count(), 1)) {}
+
+  void MstExpiryWheel::add(const DataType &batch,
+                           TimeType expiration_time,
+                           MstState &holder) {
+    auto it = positions_.find(batch);
+    if (it != positions_.end()) {
+      auto &holders = it->second.entry->holders;
+      if (std::find(holders.begin(), holders.end(), &holder) == holders.end()) {
+        holders.push_back(&holder);
+      }
+      return;
+    }
+
+    auto position = locate(expiration_time);
+    auto &slot = slotAt(position.level, position.slot);
+    position.entry =
+        slot.insert(slot.end(), Entry{batch, expiration_time, {&holder}});
+    positions_.emplace(batch, position);
+    updateOccupancy(position.level, position.slot);
+  }
+
+  void MstExpiryWheel::remove(const DataType &batch, const MstState &holder) {
+    auto it = positions_.find(batch);
+    if (it == positions_.end()) {
+      return;
+    }
+    auto &holders = it->second.entry->holders;
+    holders.erase(std::remove(holders.begin(), holders.end(), &holder),
+                  holders.end());
+    if (holders.empty()) {
+      auto position = it->second;
+      slotAt(position.level, position.slot).erase(position.entry);
+      positions_.erase(it);
+      updateOccupancy(position.level, position.slot);
+    }
+  }
+
+  std::vector<MstExpiryWheel::Expired> MstExpiryWheel::extractExpired(
+      TimeType current_time) {
+    const uint64_t now_tick = current_time / granularity_;
+    std::vector<Expired> expired;
+    last_expiry_lag_ = std::chrono::milliseconds{0};
+
+    // with no entries in the wheel the current tick jumps to the current
+    // time, e.g. to the first call
+    if (std::all_of(occupied_.begin(), occupied_.end(), [](auto bits) {
+          return bits == 0;
+        })) {
+      current_tick_ = std::max(current_tick_, now_tick);
+    }
+
+    // entries beyond the span of the wheel are placed as the wheel turns
+    for (auto entry = overflow_.begin(); entry != overflow_.end();) {
+      auto next = std::next(entry);
+      if (locate(entry->expiration_time).level < kLevels) {
+        place(overflow_, entry);
+      }
+      entry = next;
+    }
+
+    while (true) {
+      // entries of a lower level expire before the ones of higher levels
+      const size_t level =
+          std::find_if(occupied_.begin(),
+                       occupied_.end(),
+                       [](auto bits) { return bits != 0; })
+          - occupied_.begin();
+      if (level == kLevels) {
+        break;
+      }
+      size_t slot = 0;
+      while (((occupied_[level] >> slot) & 1) == 0) {
+        ++slot;
+      }
+      const auto upper_shift = kSlotBits * (level + 1);
+      const uint64_t slot_start = (current_tick_ >> upper_shift << upper_shift)
+          | (uint64_t{slot} << (kSlotBits * level));
+      if (slot_start > now_tick) {
+        break;
+      }
+      current_tick_ = std::max(current_tick_, slot_start);
+
+      auto &entries = slots_[level][slot];
+      if (level > 0) {
+        // the slot is spread over the lower levels
+        Slot cascaded;
+        cascaded.splice(cascaded.end(), entries);
+        updateOccupancy(level, slot);
+        while (not cascaded.empty()) {
+          place(cascaded, cascaded.begin());
+        }
+        continue;
+      }
+
+      for (auto entry = entries.begin(); entry != entries.end();) {
+        if (slot_start < now_tick or entry->expiration_time < current_time) {
+          last_expiry_lag_ =
+              std::max(last_expiry_lag_,
+                       std::chrono::milliseconds(current_time
+                                                 - entry->expiration_time));
+          positions_.erase(entry->batch);
+          expired.push_back(
+              Expired{std::move(entry->batch), std::move(entry->holders)});
+          entry = entries.erase(entry);
+        } else {
+          ++entry;
+        }
+      }
+      updateOccupancy(level, slot);
+      if (slot_start == now_tick) {
+        // the rest of the slot expires later within the current tick
+        break;
+      }
+    }
+    current_tick_ = std::max(current_tick_, now_tick);
+    return expired;
+  }
+
+  size_t MstExpiryWheel::size() const {
+    return positions_.size();
+  }
+
+  std::chrono::milliseconds MstExpiryWheel::lastExpiryLag() const {
+    return last_expiry_lag_;
+  }
+
+  MstExpiryWheel::Position MstExpiryWheel::locate(
+      TimeType expiration_time) const {
+    // entries which are already expired are put to the current slot
+    const auto tick = std::max(expiration_time / granularity_, current_tick_);
+    // the level is the highest group of bits in which the tick differs from
+    // the current one, so that the current tick reaches the slot of the entry
+    // only after the slots of all entries which expire earlier
+    const auto diff = tick ^ current_tick_;
+    size_t level = 0;
+    while (level < kLevels and (diff >> (kSlotBits * (level + 1))) != 0) {
+      ++level;
+    }
+    if (level == kLevels) {
+      return Position{kLevels, 0, {}};
+    }
+    return Position{level, (tick >> (kSlotBits * level)) & (kSlots - 1), {}};
+  }
+
+  MstExpiryWheel::Slot &MstExpiryWheel::slotAt(size_t level, size_t slot) {
+    return level == kLevels ? overflow_ : slots_[level][slot];
+  }
+
+  void MstExpiryWheel::place(Slot &from, Slot::iterator entry) {
+    auto target = locate(entry->expiration_time);
+    auto &to = slotAt(target.level, target.slot);
+    // the iterator stays valid and refers to the target slot
+    to.splice(to.end(), from, entry);
+    auto &position = positions_.at(entry->batch);
+    const auto source = position;
+    position.level = target.level;
+    position.slot = target.slot;
+    updateOccupancy(source.level, source.slot);
+    updateOccupancy(target.level, target.slot);
+  }
+
+  void MstExpiryWheel::updateOccupancy(size_t level, size_t slot) {
+    if (level == kLevels) {
+      return;
+    }
+    if (slots_[level][slot].empty()) {
+      occupied_[level] &= ~(uint64_t{1} << slot);
+    } else {
+      occupied_[level] |= uint64_t{1} << slot;
+    }
+  }
+
+}  // namespace iroha
@@ -43,4 +43,9 @@ namespace iroha {
   bool MstStorage::batchInStorage(const DataType &batch) const {
     return batchInStorageImpl(batch);
   }
+
+  MstStorage::ExpiryMetrics MstStorage::expiryMetrics() const {
+    std::lock_guard<std::mutex> lock{this->mutex_};
+    return expiryMetricsImpl();
+  }
 }  // namespace iroha
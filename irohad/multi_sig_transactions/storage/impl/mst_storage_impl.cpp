@@ -5,6 +5,8 @@
 
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 
+#include "logger/logger.hpp"
+
 namespace iroha {
   // ------------------------------| private API |------------------------------
 
@@ -20,6 +22,16 @@ namespace iroha {
     }
     return target_state_iter;
   }
+
+  void MstStorageStateImpl::trackExpiration(MstState &state,
+                                            const DataType &batch) {
+    if (state.contains(batch)) {
+      expiry_wheel_.add(batch, completer_->expirationTime(batch), state);
+    } else {
+      expiry_wheel_.remove(batch, state);
+    }
+  }
+
   // -----------------------------| interface API |-----------------------------
   MstStorageStateImpl::MstStorageStateImpl(MstStorageStateImpl::private_tag,
                                            CompleterType const &completer,
@@ -48,10 +60,16 @@ namespace iroha {
         [storage_,
          subscription](shared_model::interface::types::HashType const &hash) {
           if (auto storage = storage_.lock()) {
+            std::lock_guard<std::mutex> lock{storage->mutex_};
+            auto erase = [&storage, &hash](MstState &state) {
+              if (auto batch = state.eraseByTransactionHash(hash)) {
+                storage->expiry_wheel_.remove(*batch, state);
+              }
+            };
             for (auto &p : storage->peer_states_) {
-              p.second.eraseByTransactionHash(hash);
+              erase(p.second);
             }
-            storage->own_state_.eraseByTransactionHash(hash);
+            erase(storage->own_state_);
           } else {
             subscription.unsubscribe();
           }
@@ -64,23 +82,39 @@ namespace iroha {
       shared_model::interface::types::PublicKeyHexStringView target_peer_key,
       const MstState &new_state)
       -> decltype(apply(target_peer_key, new_state)) {
-    auto target_state_iter = getState(target_peer_key);
-    target_state_iter->second += new_state;
-    return own_state_ += new_state;
+    auto &target_state = getState(target_peer_key)->second;
+    target_state += new_state;
+    auto result = own_state_ += new_state;
+    new_state.iterateBatches([this, &target_state](const auto &batch) {
+      this->trackExpiration(target_state, batch);
+      this->trackExpiration(own_state_, batch);
+    });
+    return result;
   }
 
   auto MstStorageStateImpl::updateOwnStateImpl(const DataType &tx)
       -> decltype(updateOwnState(tx)) {
-    return own_state_ += tx;
+    auto result = own_state_ += tx;
+    trackExpiration(own_state_, tx);
+    return result;
   }
 
   auto MstStorageStateImpl::extractExpiredTransactionsImpl(
       const TimeType &current_time)
       -> decltype(extractExpiredTransactions(current_time)) {
-    for (auto &peer_and_state : peer_states_) {
-      peer_and_state.second.eraseExpired(current_time);
+    auto expired_state = MstState::empty(mst_state_logger_, completer_);
+    for (auto &expired : expiry_wheel_.extractExpired(current_time)) {
+      for (auto holder : expired.holders) {
+        auto batch = holder->extractBatch(expired.batch);
+        if (batch and holder == &own_state_) {
+          expired_state += *batch;
+        }
+      }
     }
-    return own_state_.extractExpired(current_time);
+    log_->debug("{} batches are pending expiration, expiry lag is {} ms",
+                expiry_wheel_.size(),
+                expiry_wheel_.lastExpiryLag().count());
+    return expired_state;
   }
 
   auto MstStorageStateImpl::getDiffStateImpl(
@@ -102,4 +136,8 @@ namespace iroha {
     return own_state_.contains(batch);
   }
 
+  auto MstStorageStateImpl::expiryMetricsImpl() const -> ExpiryMetrics {
+    return ExpiryMetrics{expiry_wheel_.size(), expiry_wheel_.lastExpiryLag()};
+  }
+
 }  // namespace iroha
@@ -0,0 +1,120 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MST_EXPIRY_WHEEL_HPP
+#define IROHA_MST_EXPIRY_WHEEL_HPP
+
+#include <array>
+#include <chrono>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "multi_sig_transactions/hash.hpp"
+#include "multi_sig_transactions/mst_types.hpp"
+
+namespace iroha {
+
+  /**
+   * Hierarchical timer wheel of expiration times of the batches, shared by
+   * all MST states of a storage. Every batch is kept once together with the
+   * states which hold it, so expired batches are found without a sweep of
+   * every state, and extraction takes time proportional to the number of
+   * expired batches.
+   */
+  class MstExpiryWheel {
+   public:
+    /// batch which has expired and the states which held it
+    struct Expired {
+      DataType batch;
+      std::vector<MstState *> holders;
+    };
+
+    /**
+     * @param granularity - time span of the slots of the lowest level
+     */
+    explicit MstExpiryWheel(
+        std::chrono::milliseconds granularity = std::chrono::seconds(1));
+
+    /**
+     * Add the state to the holders of the batch
+     * @param batch - batch held by the state
+     * @param expiration_time - time after which the batch is expired, used
+     * only when the batch is not in the wheel yet
+     * @param holder - state which holds the batch
+     */
+    void add(const DataType &batch,
+             TimeType expiration_time,
+             MstState &holder);
+
+    /**
+     * Remove the state from the holders of the batch, the batch is removed
+     * from the wheel when no state holds it
+     */
+    void remove(const DataType &batch, const MstState &holder);
+
+    /**
+     * Remove and return the batches expiration time of which is before the
+     * current time
+     */
+    std::vector<Expired> extractExpired(TimeType current_time);
+
+    /// @return number of batches in the wheel
+    size_t size() const;
+
+    /// @return maximal delay between expiration and extraction of the
+    /// batches extracted by the last call of extractExpired
+    std::chrono::milliseconds lastExpiryLag() const;
+
+   private:
+    static constexpr size_t kSlotBits = 6;
+    static constexpr size_t kSlots = 1 << kSlotBits;
+    static constexpr size_t kLevels = 4;
+
+    struct Entry {
+      DataType batch;
+      TimeType expiration_time;
+      std::vector<MstState *> holders;
+    };
+
+    using Slot = std::list<Entry>;
+
+    /// level kLevels stands for the overflow list
+    struct Position {
+      size_t level;
+      size_t slot;
+      Slot::iterator entry;
+    };
+
+    /// @return position of the entry with the expiration time relative to
+    /// the current tick, the iterator is not set
+    Position locate(TimeType expiration_time) const;
+
+    Slot &slotAt(size_t level, size_t slot);
+
+    /// Move the entry from its slot to the position of its expiration time
+    void place(Slot &from, Slot::iterator entry);
+
+    /// Update the occupancy bit of the slot
+    void updateOccupancy(size_t level, size_t slot);
+
+    const uint64_t granularity_;
+    uint64_t current_tick_ = 0;
+    std::array<std::array<Slot, kSlots>, kLevels> slots_;
+    std::array<uint64_t, kLevels> occupied_{};
+    /// entries which expire beyond the span of the wheel
+    Slot overflow_;
+    std::unordered_map<DataType,
+                       Position,
+                       iroha::model::PointerBatchHasher,
+                       shared_model::interface::BatchHashEquality>
+        positions_;
+    std::chrono::milliseconds last_expiry_lag_{0};
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_MST_EXPIRY_WHEEL_HPP
@@ -6,6 +6,7 @@
 #ifndef IROHA_MST_STORAGE_HPP
 #define IROHA_MST_STORAGE_HPP
 
+#include <chrono>
 #include <mutex>
 
 #include "interfaces/common_objects/string_view_types.hpp"
@@ -75,6 +76,21 @@ namespace iroha {
      */
     bool batchInStorage(const DataType &batch) const;
 
+    /// Metrics of the expiration of batches
+    struct ExpiryMetrics {
+      /// number of batches which are waiting for expiration
+      size_t pending_batches;
+      /// maximal delay between expiration and extraction of the batches
+      /// extracted by the last extraction
+      std::chrono::milliseconds expiry_lag;
+    };
+
+    /**
+     * @return metrics of the expiration of batches
+     * General note: implementation of method covered by lock
+     */
+    ExpiryMetrics expiryMetrics() const;
+
     virtual ~MstStorage() = default;
 
    protected:
@@ -107,11 +123,14 @@ namespace iroha {
 
     virtual bool batchInStorageImpl(const DataType &batch) const = 0;
 
-    // -------------------------------| fields |--------------------------------
+    virtual ExpiryMetrics expiryMetricsImpl() const = 0;
 
-    mutable std::mutex mutex_;
+    // -------------------------------| fields |--------------------------------
 
    protected:
+    /// also taken by implementations which change the state outside of the
+    /// user API, e.g. on a notification
+    mutable std::mutex mutex_;
     logger::LoggerPtr log_;
   };
 }  // namespace iroha
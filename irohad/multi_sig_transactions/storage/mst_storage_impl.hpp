@@ -12,6 +12,7 @@
 #include <rxcpp/rx-lite.hpp>
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/hash.hpp"
+#include "multi_sig_transactions/storage/mst_expiry_wheel.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
 
 namespace iroha {
@@ -30,6 +31,12 @@ namespace iroha {
     auto getState(
         shared_model::interface::types::PublicKeyHexStringView target_peer_key);
 
+    /**
+     * Add the state to the holders of the batch in the expiry wheel if the
+     * state contains the batch, remove it otherwise
+     */
+    void trackExpiration(MstState &state, const DataType &batch);
+
    public:
     // ----------------------------| interface API |----------------------------
     MstStorageStateImpl(MstStorageStateImpl::private_tag,
@@ -68,6 +75,8 @@ namespace iroha {
 
     bool batchInStorageImpl(const DataType &batch) const override;
 
+    ExpiryMetrics expiryMetricsImpl() const override;
+
    private:
     // ---------------------------| private fields |----------------------------
 
@@ -98,6 +107,8 @@ namespace iroha {
     std::unordered_map<StringViewOrString, MstState, StringViewOrString::Hash>
         peer_states_;
     MstState own_state_;
+    /// expiration of the batches of the own and peer states
+    MstExpiryWheel expiry_wheel_;
 
     logger::LoggerPtr mst_state_logger_;  ///< Logger for created MstState
                                           ///< objects.
@@ -194,7 +194,8 @@ void sendStateAsyncImpl(
         std::static_pointer_cast<shared_model::proto::Transaction>(tx)
             ->getTransport();
   });
-  async_call.Call(
+  async_call.CallPeer(
+      to.address(),
       [client = sender_factory(to), proto_state = std::move(proto_state)](
           auto context, auto cq) {
         return client->AsyncSendState(context, proto_state, cq);
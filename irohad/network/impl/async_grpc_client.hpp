@@ -6,8 +6,19 @@
 #ifndef IROHA_ASYNC_GRPC_CLIENT_HPP
 #define IROHA_ASYNC_GRPC_CLIENT_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <ciso646>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
 #include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
@@ -18,43 +29,112 @@ namespace iroha {
   namespace network {
 
     /**
-     * Asynchronous gRPC client which does no processing of server responses
+     * Asynchronous gRPC client which does no processing of server responses.
+     * Completions are processed by a pool of completion queues, each drained
+     * by its own thread. Calls to the same peer always go to the same queue,
+     * so responses from one peer are processed in order.
      * @tparam Response type of server response
      */
     template <typename Response>
     class AsyncGrpcClient {
      public:
-      explicit AsyncGrpcClient(logger::LoggerPtr log)
-          : thread_(&AsyncGrpcClient::asyncCompleteRpc, this),
-            log_(std::move(log)) {}
+      using OnResponse = std::function<void(grpc::Status &, Response &)>;
+
+      /// Maximum number of finished call objects kept for reuse per queue
+      static constexpr size_t kMaxPooledCalls = 1024;
 
       /**
-       * Listen to gRPC server responses
+       * @param log - logger
+       * @param queues - number of completion queues with their threads
+       * @param max_in_flight_per_peer - maximum number of unfinished calls to
+       * a single peer. A call over the limit blocks the caller until one of
+       * the calls to the peer finishes. Zero means no limit
        */
-      void asyncCompleteRpc() {
-        void *got_tag;
-        auto ok = false;
-        while (cq_.Next(&got_tag, &ok)) {
-          auto call = static_cast<AsyncClientCall *>(got_tag);
-          if (not call->status.ok()) {
-            log_->warn("RPC failed: {}", call->status.error_message());
-          }
-          if (call->on_response) {
-            call->on_response(call->status, call->reply);
-          }
-          delete call;
+      explicit AsyncGrpcClient(logger::LoggerPtr log,
+                               size_t queues = 1,
+                               size_t max_in_flight_per_peer = 0)
+          : log_(std::move(log)),
+            max_in_flight_per_peer_(max_in_flight_per_peer) {
+        queues = std::max<size_t>(queues, 1);
+        workers_.reserve(queues);
+        for (size_t i = 0; i < queues; ++i) {
+          workers_.emplace_back(std::make_unique<Worker>());
+        }
+        for (auto &worker : workers_) {
+          worker->thread = std::thread(
+              &AsyncGrpcClient::asyncCompleteRpc, this, std::ref(*worker));
         }
       }
 
       ~AsyncGrpcClient() {
-        cq_.Shutdown();
-        if (thread_.joinable()) {
-          thread_.join();
+        for (auto &worker : workers_) {
+          worker->cq.Shutdown();
+        }
+        for (auto &worker : workers_) {
+          if (worker->thread.joinable()) {
+            worker->thread.join();
+          }
+        }
+      }
+
+      /**
+       * Universal method to perform all needed sends. The call is assigned
+       * to the completion queues in round-robin manner
+       * @tparam lambda which must return unique pointer to
+       * ClientAsyncResponseReader<Response> object
+       */
+      template <typename F>
+      void Call(F &&lambda, OnResponse on_response = {}) {
+        auto &worker =
+            *workers_[next_worker_.fetch_add(1, std::memory_order_relaxed)
+                      % workers_.size()];
+        startCall(
+            worker, nullptr, std::forward<F>(lambda), std::move(on_response));
+      }
+
+      /**
+       * Same as Call, but the call is bound to the completion queue of the
+       * given peer and counted against its in-flight limit. When the limit
+       * is reached, the caller is blocked until a call to the peer finishes,
+       * so no call is dropped. Response handlers, which run on the threads of
+       * the completion queues, are not blocked, as the calls they would wait
+       * for can only finish on these threads, where other handlers could wait
+       * in turn.
+       * @param peer_address - address of the call destination
+       */
+      template <typename F>
+      void CallPeer(const std::string &peer_address,
+                    F &&lambda,
+                    OnResponse on_response = {}) {
+        auto &peer = getPeer(peer_address);
+        auto &worker = *workers_[peer.worker];
+        {
+          std::unique_lock<std::mutex> lock(peer.mutex);
+          if (max_in_flight_per_peer_ != 0
+              and peer.in_flight >= max_in_flight_per_peer_
+              and not isWorkerThread()) {
+            log_->debug("Waiting for {} calls in flight to {}",
+                        peer.in_flight.load(),
+                        peer_address);
+            peer.call_finished.wait(lock, [this, &peer] {
+              return peer.in_flight < max_in_flight_per_peer_;
+            });
+          }
+          ++peer.in_flight;
         }
+        startCall(
+            worker, &peer, std::forward<F>(lambda), std::move(on_response));
       }
 
-      grpc::CompletionQueue cq_;
-      std::thread thread_;
+      /**
+       * @return number of unfinished calls to the given peer
+       */
+      size_t inFlight(const std::string &peer_address) {
+        return getPeer(peer_address).in_flight.load();
+      }
+
+     private:
+      struct PeerState;
 
       /**
        * State and data information of gRPC call
@@ -69,26 +149,122 @@ namespace iroha {
         std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<Response>>
             response_reader;
 
-        std::function<void(grpc::Status &, Response &)> on_response;
+        OnResponse on_response;
+
+        /// destination peer, if the call is counted against its limit
+        PeerState *peer = nullptr;
       };
 
+      using CallStorage = std::aligned_storage_t<sizeof(AsyncClientCall),
+                                                 alignof(AsyncClientCall)>;
+
       /**
-       * Universal method to perform all needed sends
-       * @tparam lambda which must return unique pointer to
-       * ClientAsyncResponseReader<Response> object
+       * Completion queue with its thread and a pool of call objects
        */
+      struct Worker {
+        grpc::CompletionQueue cq;
+        std::thread thread;
+        std::mutex pool_mutex;
+        std::vector<std::unique_ptr<CallStorage>> free_calls;
+      };
+
+      struct PeerState {
+        size_t worker;
+        std::mutex mutex;
+        std::condition_variable call_finished;
+        /// changed under the mutex, read without it for statistics
+        std::atomic<size_t> in_flight{0};
+      };
+
+      PeerState &getPeer(const std::string &peer_address) {
+        std::lock_guard<std::mutex> lock(peers_mutex_);
+        auto it = peers_.find(peer_address);
+        if (it == peers_.end()) {
+          auto peer = std::make_unique<PeerState>();
+          peer->worker =
+              std::hash<std::string>{}(peer_address) % workers_.size();
+          it = peers_.emplace(peer_address, std::move(peer)).first;
+        }
+        return *it->second;
+      }
+
+      /// @return true if called from the thread of a completion queue
+      bool isWorkerThread() const {
+        const auto id = std::this_thread::get_id();
+        return std::any_of(
+            workers_.begin(), workers_.end(), [id](const auto &worker) {
+              return worker->thread.get_id() == id;
+            });
+      }
+
+      AsyncClientCall *acquireCall(Worker &worker) {
+        std::unique_ptr<CallStorage> storage;
+        {
+          std::lock_guard<std::mutex> lock(worker.pool_mutex);
+          if (not worker.free_calls.empty()) {
+            storage = std::move(worker.free_calls.back());
+            worker.free_calls.pop_back();
+          }
+        }
+        if (not storage) {
+          storage = std::make_unique<CallStorage>();
+        }
+        return new (storage.release()) AsyncClientCall;
+      }
+
+      void releaseCall(Worker &worker, AsyncClientCall *call) {
+        call->~AsyncClientCall();
+        std::unique_ptr<CallStorage> storage(
+            reinterpret_cast<CallStorage *>(call));
+        std::lock_guard<std::mutex> lock(worker.pool_mutex);
+        if (worker.free_calls.size() < kMaxPooledCalls) {
+          worker.free_calls.push_back(std::move(storage));
+        }
+      }
+
       template <typename F>
-      void Call(
-          F &&lambda,
-          std::function<void(grpc::Status &, Response &)> on_response = {}) {
-        auto call = new AsyncClientCall;
+      void startCall(Worker &worker,
+                     PeerState *peer,
+                     F &&lambda,
+                     OnResponse on_response) {
+        auto call = acquireCall(worker);
         call->on_response = std::move(on_response);
-        call->response_reader = lambda(&call->context, &cq_);
+        call->peer = peer;
+        call->response_reader = lambda(&call->context, &worker.cq);
         call->response_reader->Finish(&call->reply, &call->status, call);
       }
 
-     private:
+      /**
+       * Listen to gRPC server responses
+       */
+      void asyncCompleteRpc(Worker &worker) {
+        void *got_tag;
+        auto ok = false;
+        while (worker.cq.Next(&got_tag, &ok)) {
+          auto call = static_cast<AsyncClientCall *>(got_tag);
+          if (not call->status.ok()) {
+            log_->warn("RPC failed: {}", call->status.error_message());
+          }
+          if (call->on_response) {
+            call->on_response(call->status, call->reply);
+          }
+          if (call->peer) {
+            {
+              std::lock_guard<std::mutex> lock(call->peer->mutex);
+              --call->peer->in_flight;
+            }
+            call->peer->call_finished.notify_one();
+          }
+          releaseCall(worker, call);
+        }
+      }
+
       logger::LoggerPtr log_;
+      const size_t max_in_flight_per_peer_;
+      std::vector<std::unique_ptr<Worker>> workers_;
+      std::atomic<size_t> next_worker_{0};
+      std::mutex peers_mutex_;
+      std::unordered_map<std::string, std::unique_ptr<PeerState>> peers_;
     };
   }  // namespace network
 }  // namespace iroha
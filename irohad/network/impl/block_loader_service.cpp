@@ -36,15 +36,22 @@ BlockLoaderService::BlockLoaderService(
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<iroha::consensus::ConsensusResultCache>
         consensus_result_cache,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    bool compress_blocks)
     : block_query_factory_(std::move(block_query_factory)),
       consensus_result_cache_(std::move(consensus_result_cache)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      compress_blocks_(compress_blocks) {}
 
 grpc::Status BlockLoaderService::retrieveBlocks(
     ::grpc::ServerContext *context,
     const proto::BlockRequest *request,
     ::grpc::ServerWriter<::iroha::protocol::Block> *writer) {
+  if (compress_blocks_) {
+    // gRPC falls back to no compression if the client does not accept gzip
+    context->set_compression_algorithm(GRPC_COMPRESS_GZIP);
+  }
+
   auto block_query = block_query_factory_->createBlockQuery();
   if (not block_query) {
     log_->error("Could not create block query to retrieve block from storage");
@@ -79,6 +86,10 @@ grpc::Status BlockLoaderService::retrieveBlock(
     ::grpc::ServerContext *context,
     const proto::BlockRequest *request,
     protocol::Block *response) {
+  if (compress_blocks_) {
+    context->set_compression_algorithm(GRPC_COMPRESS_GZIP);
+  }
+
   const auto height = request->height();
 
   // try to fetch block from the consensus cache
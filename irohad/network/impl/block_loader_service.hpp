@@ -15,11 +15,19 @@ namespace iroha {
   namespace network {
     class BlockLoaderService : public proto::Loader::Service {
      public:
+      /**
+       * @param block_query_factory - factory of block queries
+       * @param consensus_result_cache - cache of the last consensus result
+       * @param log - logger
+       * @param compress_blocks - compress the sent blocks with gzip if the
+       * requesting peer supports it
+       */
       BlockLoaderService(
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<iroha::consensus::ConsensusResultCache>
               consensus_result_cache,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          bool compress_blocks = false);
 
       grpc::Status retrieveBlocks(
           ::grpc::ServerContext *context,
@@ -35,6 +43,7 @@ namespace iroha {
       std::shared_ptr<iroha::consensus::ConsensusResultCache>
           consensus_result_cache_;
       logger::LoggerPtr log_;
+      const bool compress_blocks_;
     };
   }  // namespace network
 }  // namespace iroha
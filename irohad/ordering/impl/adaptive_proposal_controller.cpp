@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_proposal_controller.hpp"
+
+#include <algorithm>
+
+#include "logger/logger.hpp"
+
+using namespace iroha::ordering;
+
+namespace {
+  AdaptiveProposalController::Config checkBounds(
+      AdaptiveProposalController::Config config) {
+    config.max_proposal_size = std::max<size_t>(config.max_proposal_size, 1);
+    config.min_proposal_size = std::clamp<size_t>(
+        config.min_proposal_size, 1, config.max_proposal_size);
+    return config;
+  }
+}  // namespace
+
+AdaptiveProposalController::AdaptiveProposalController(Config config,
+                                                       logger::LoggerPtr log)
+    : config_(checkBounds(config)),
+      decision_{config_.max_proposal_size,
+                std::chrono::milliseconds::zero(),
+                0,
+                std::chrono::milliseconds::zero(),
+                std::chrono::milliseconds::zero()},
+      log_(std::move(log)) {}
+
+void AdaptiveProposalController::onProposal(const consensus::Round &round,
+                                            size_t transactions) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  measurement_ = Measurement{round, transactions, Clock::now(), boost::none};
+}
+
+void AdaptiveProposalController::onVerifiedProposal(
+    const consensus::Round &round) {
+  auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (not measurement_ or measurement_->round != round
+      or measurement_->verified_time) {
+    return;
+  }
+  measurement_->verified_time = now;
+  decision_.validation_time =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          now - measurement_->proposal_time);
+}
+
+void AdaptiveProposalController::onCommit(consensus::BlockRoundType height) {
+  auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (not measurement_ or not measurement_->verified_time
+      or measurement_->round.block_round != height) {
+    return;
+  }
+  decision_.commit_time =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          now - *measurement_->verified_time);
+  adjust(*measurement_,
+         std::chrono::duration_cast<std::chrono::milliseconds>(
+             now - measurement_->proposal_time));
+  measurement_ = boost::none;
+}
+
+size_t AdaptiveProposalController::proposalSize(size_t queue_depth) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto size = decision_.proposal_size;
+  const auto round_time = decision_.validation_time + decision_.commit_time;
+  decision_.queue_depth = queue_depth;
+  decision_.round_delay = std::chrono::milliseconds::zero();
+  if (queue_depth < size and round_time < config_.target_round_time) {
+    // the spare time of the round is used to collect the missing
+    // transactions
+    auto spare = (config_.target_round_time - round_time).count();
+    decision_.round_delay =
+        std::min(config_.max_round_delay,
+                 std::chrono::milliseconds(spare * static_cast<int64_t>(
+                                               size - queue_depth)
+                                           / static_cast<int64_t>(size)));
+  }
+  log_->info(
+      "Proposal size {}, round delay {} ms for {} queued transactions, "
+      "validation time {} ms, commit time {} ms",
+      decision_.proposal_size,
+      decision_.round_delay.count(),
+      decision_.queue_depth,
+      decision_.validation_time.count(),
+      decision_.commit_time.count());
+  return size;
+}
+
+std::chrono::milliseconds AdaptiveProposalController::roundDelay() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return decision_.round_delay;
+}
+
+AdaptiveProposalController::Decision AdaptiveProposalController::lastDecision()
+    const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return decision_;
+}
+
+void AdaptiveProposalController::adjust(const Measurement &measurement,
+                                        std::chrono::milliseconds round_time) {
+  auto &size = decision_.proposal_size;
+  if (round_time > config_.target_round_time) {
+    size = std::max(config_.min_proposal_size, size / 2);
+  } else if (decision_.queue_depth > size) {
+    // proposals are cut by the size while rounds fit the target time
+    size = std::min(config_.max_proposal_size,
+                    size + std::max<size_t>(size / 8, 1));
+  }
+  log_->debug("Round {} of {} transactions took {} ms, proposal size is {}",
+              measurement.round,
+              measurement.transactions,
+              round_time.count(),
+              size);
+}
@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ADAPTIVE_PROPOSAL_CONTROLLER_HPP
+#define IROHA_ADAPTIVE_PROPOSAL_CONTROLLER_HPP
+
+#include <chrono>
+#include <mutex>
+
+#include <boost/optional.hpp>
+#include "consensus/round.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Adjusts the number of transactions in proposals and the delay of the
+     * round after a commit within configured bounds. The time of validation
+     * of a proposal and the time from its validation to the commit of its
+     * block are measured for every round. When the round takes longer than
+     * the target time, the proposal size is halved. When it fits the target
+     * and the proposal was cut by the size, the size grows by an eighth.
+     * When the queue of the ordering service does not fill a proposal, the
+     * next round is delayed by the unused part of the target time in
+     * proportion to the unfilled part of the proposal, so that more
+     * transactions are collected into a block.
+     */
+    class AdaptiveProposalController {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      struct Config {
+        /// lower bound of the proposal size
+        size_t min_proposal_size;
+        /// upper bound of the proposal size
+        size_t max_proposal_size;
+        /// desired time from receiving a proposal to the commit of its block
+        std::chrono::milliseconds target_round_time;
+        /// upper bound of the delay of the round after a commit
+        std::chrono::milliseconds max_round_delay;
+      };
+
+      /// The last decision with the measurements it is based on
+      struct Decision {
+        size_t proposal_size;
+        std::chrono::milliseconds round_delay;
+        /// number of transactions waiting in the ordering service
+        size_t queue_depth;
+        /// time of validation of the last measured proposal
+        std::chrono::milliseconds validation_time;
+        /// time from the validation to the commit of the last measured block
+        std::chrono::milliseconds commit_time;
+      };
+
+      AdaptiveProposalController(Config config, logger::LoggerPtr log);
+
+      /**
+       * Start measurement of a round
+       * @param round - round of the received proposal
+       * @param transactions - number of transactions in the proposal
+       */
+      void onProposal(const consensus::Round &round, size_t transactions);
+
+      /// Record the validation time of the proposal of the round
+      void onVerifiedProposal(const consensus::Round &round);
+
+      /// Record the commit time of the block with the height
+      void onCommit(consensus::BlockRoundType height);
+
+      /**
+       * Decide the size of the next proposal
+       * @param queue_depth - number of transactions waiting in the ordering
+       * service
+       * @return maximal number of transactions in the proposal
+       */
+      size_t proposalSize(size_t queue_depth);
+
+      /// @return delay of the round after a commit
+      std::chrono::milliseconds roundDelay() const;
+
+      /// @return the last decision
+      Decision lastDecision() const;
+
+     private:
+      struct Measurement {
+        consensus::Round round;
+        size_t transactions;
+        Clock::time_point proposal_time;
+        boost::optional<Clock::time_point> verified_time;
+      };
+
+      /// Adjust the size by the round time of the measured round
+      void adjust(const Measurement &measurement,
+                  std::chrono::milliseconds round_time);
+
+      const Config config_;
+      mutable std::mutex mutex_;
+      boost::optional<Measurement> measurement_;
+      Decision decision_;
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ADAPTIVE_PROPOSAL_CONTROLLER_HPP
@@ -5,8 +5,11 @@
 
 #include "ordering/impl/on_demand_connection_manager.hpp"
 
-#include <boost/range/combine.hpp>
+#include <algorithm>
+
+#include <rxcpp/operators/rx-observe_on.hpp>
 #include "interfaces/iroha_internal/proposal.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 
@@ -16,29 +19,38 @@ using namespace iroha::ordering;
 OnDemandConnectionManager::OnDemandConnectionManager(
     std::shared_ptr<transport::OdOsNotificationFactory> factory,
     rxcpp::observable<CurrentPeers> peers,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    BatchForwardingConfig forwarding)
     : log_(std::move(log)),
       factory_(std::move(factory)),
+      forwarding_(forwarding),
       subscription_(peers.subscribe([this](const auto &peers) {
         // `this' is captured raw and needs protection during destruction of
         // OnDemandConnectionManager. We assert that
         // OnDemandConnectionManager::initializeConnections locks the mutex and
         // does not use `this' if stop_requested_ reads `true'.
         this->initializeConnections(peers);
-      })) {}
+      })),
+      // the same worker is used for all the flushes
+      flush_worker_(rxcpp::observe_on_new_thread()
+                        .create_coordinator(flush_lifetime_)
+                        .get_worker()) {}
 
 OnDemandConnectionManager::OnDemandConnectionManager(
     std::shared_ptr<transport::OdOsNotificationFactory> factory,
     rxcpp::observable<CurrentPeers> peers,
     CurrentPeers initial_peers,
-    logger::LoggerPtr log)
-    : OnDemandConnectionManager(std::move(factory), peers, std::move(log)) {
+    logger::LoggerPtr log,
+    BatchForwardingConfig forwarding)
+    : OnDemandConnectionManager(
+          std::move(factory), peers, std::move(log), forwarding) {
   // using start_with(initial_peers) results in deadlock
   initializeConnections(initial_peers);
 }
 
 OnDemandConnectionManager::~OnDemandConnectionManager() {
   subscription_.unsubscribe();
+  flush_lifetime_.unsubscribe();
   stop_requested_.store(true);
   std::lock_guard<std::shared_timed_mutex> lock(mutex_);
 }
@@ -55,19 +67,91 @@ void OnDemandConnectionManager::onBatches(CollectionType batches) {
    *  1 . . .       1 x v .       1 v . .       1 x . .
    *  2 . . .       2 . . .       2 . . .       2 v . .
    * RejectReject  CommitReject  RejectCommit  CommitCommit
+   *
+   * Every consumer peer gets a batch once per round, even when it consumes
+   * several of these rounds. Unless the forwarding window is zero, the
+   * batches are collected per peer and sent in a single request when the
+   * window ends or enough batches are collected.
    */
 
-  auto propagate = [&](auto consumer) {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    if (not stop_requested_.load(std::memory_order_relaxed)) {
-      connections_.peers[consumer]->onBatches(batches);
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  if (stop_requested_.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  std::vector<Request> requests;
+  {
+    std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+    for (auto &destination : destinations_) {
+      CollectionType unsent;
+      for (auto &batch : batches) {
+        if (destination.sent.insert(batch->reducedHash()).second) {
+          unsent.push_back(batch);
+        }
+      }
+
+      if (unsent.empty()) {
+        continue;
+      }
+      if (forwarding_.window == std::chrono::microseconds::zero()) {
+        ++forwarded_requests_;
+        forwarded_batches_ += unsent.size();
+        requests.emplace_back(destination.connection, std::move(unsent));
+        continue;
+      }
+
+      destination.buffer.insert(destination.buffer.end(),
+                                std::make_move_iterator(unsent.begin()),
+                                std::make_move_iterator(unsent.end()));
+      if (destination.buffer.size() >= forwarding_.max_batches) {
+        ++forwarded_requests_;
+        forwarded_batches_ += destination.buffer.size();
+        requests.emplace_back(destination.connection,
+                              std::move(destination.buffer));
+        destination.buffer.clear();
+      } else if (not flush_scheduled_) {
+        flush_scheduled_ = true;
+        flush_worker_.schedule(
+            flush_worker_.now() + forwarding_.window,
+            [this](const rxcpp::schedulers::schedulable &) { flush(); });
+      }
     }
-  };
+  }
+  send(std::move(requests));
+}
 
-  propagate(kRejectRejectConsumer);
-  propagate(kRejectCommitConsumer);
-  propagate(kCommitRejectConsumer);
-  propagate(kCommitCommitConsumer);
+void OnDemandConnectionManager::takeBuffers(std::vector<Request> &requests) {
+  for (auto &destination : destinations_) {
+    if (not destination.buffer.empty()) {
+      ++forwarded_requests_;
+      forwarded_batches_ += destination.buffer.size();
+      requests.emplace_back(destination.connection,
+                            std::move(destination.buffer));
+      destination.buffer.clear();
+    }
+  }
+}
+
+void OnDemandConnectionManager::send(std::vector<Request> requests) {
+  for (auto &request : requests) {
+    request.first->onBatches(std::move(request.second));
+  }
+}
+
+void OnDemandConnectionManager::flush() {
+  // `this' is protected the same way as in the peers subscription
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  if (stop_requested_.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  std::vector<Request> requests;
+  {
+    std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+    flush_scheduled_ = false;
+    takeBuffers(requests);
+  }
+  send(std::move(requests));
 }
 
 boost::optional<std::shared_ptr<const OnDemandConnectionManager::ProposalType>>
@@ -89,11 +173,44 @@ void OnDemandConnectionManager::initializeConnections(
     // Object was destroyed and `this' is no longer valid.
     return;
   }
-  auto create_assign = [this](auto &ptr, auto &peer) {
-    ptr = factory_->create(*peer);
-  };
+  std::vector<Request> requests;
+  {
+    std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+    // batches collected in the previous round are sent to its consumers
+    takeBuffers(requests);
+    if (forwarded_requests_ != 0) {
+      log_->info("Forwarded {} batches in {} requests, {:.2f} per request",
+                 forwarded_batches_,
+                 forwarded_requests_,
+                 static_cast<double>(forwarded_batches_) / forwarded_requests_);
+    }
+    forwarded_batches_ = 0;
+    forwarded_requests_ = 0;
+  }
+  send(std::move(requests));
 
-  for (auto &&pair : boost::combine(connections_.peers, peers.peers)) {
-    create_assign(boost::get<0>(pair), boost::get<1>(pair));
+  for (size_t i = 0; i < kCount; ++i) {
+    auto same_peer = std::find(
+        peers.peers.begin(), peers.peers.begin() + i, peers.peers[i]);
+    connections_.peers[i] = same_peer != peers.peers.begin() + i
+        ? connections_.peers[same_peer - peers.peers.begin()]
+        : std::shared_ptr<transport::OdOsNotification>(
+              factory_->create(*peers.peers[i]));
+  }
+
+  std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+  destinations_.clear();
+  for (auto consumer : {kRejectRejectConsumer,
+                        kRejectCommitConsumer,
+                        kCommitRejectConsumer,
+                        kCommitCommitConsumer}) {
+    auto same_peer = std::find_if(
+        destinations_.begin(), destinations_.end(), [&](const auto &d) {
+          return d.peer == peers.peers[consumer];
+        });
+    if (same_peer == destinations_.end()) {
+      destinations_.push_back(Destination{
+          peers.peers[consumer], connections_.peers[consumer], {}, {}});
+    }
   }
 }
@@ -9,14 +9,30 @@
 #include "ordering/on_demand_os_transport.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_set>
 
 #include <rxcpp/rx-lite.hpp>
+#include "cryptography/hash.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
   namespace ordering {
 
+    /**
+     * Coalescing of the batches sent to each ordering service
+     */
+    struct BatchForwardingConfig {
+      /// time the batches are collected for before they are sent in a single
+      /// request, zero to send each collection as it is passed
+      std::chrono::microseconds window{0};
+      /// number of collected batches which are sent without waiting for the
+      /// window to end
+      size_t max_batches = 100;
+    };
+
     /**
      * Proxy class which redirects requests to appropriate peers
      */
@@ -54,13 +70,15 @@ namespace iroha {
       OnDemandConnectionManager(
           std::shared_ptr<transport::OdOsNotificationFactory> factory,
           rxcpp::observable<CurrentPeers> peers,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          BatchForwardingConfig forwarding = BatchForwardingConfig{});
 
       OnDemandConnectionManager(
           std::shared_ptr<transport::OdOsNotificationFactory> factory,
           rxcpp::observable<CurrentPeers> peers,
           CurrentPeers initial_peers,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          BatchForwardingConfig forwarding = BatchForwardingConfig{});
 
       ~OnDemandConnectionManager() override;
 
@@ -71,27 +89,71 @@ namespace iroha {
 
      private:
       /**
-       * Corresponding connections created by OdOsNotificationFactory
+       * Corresponding connections created by OdOsNotificationFactory. Types
+       * assigned to the same peer share the connection
        * @see PeerType for individual descriptions
        */
       struct CurrentConnections {
-        PeerCollectionType<std::unique_ptr<transport::OdOsNotification>> peers;
+        PeerCollectionType<std::shared_ptr<transport::OdOsNotification>> peers;
       };
 
+      /**
+       * Consumer peer of the current round with the batches collected for it
+       */
+      struct Destination {
+        std::shared_ptr<shared_model::interface::Peer> peer;
+        std::shared_ptr<transport::OdOsNotification> connection;
+        CollectionType buffer;
+        /// reduced hashes of the batches sent to the peer in the round
+        std::unordered_set<shared_model::crypto::Hash,
+                           shared_model::crypto::Hash::Hasher>
+            sent;
+      };
+
+      /// Batches to be passed to a connection
+      using Request =
+          std::pair<std::shared_ptr<transport::OdOsNotification>,
+                    CollectionType>;
+
       /**
        * Initialize corresponding peers in connections_ using factory_
        * @param peers to initialize connections with
        */
       void initializeConnections(const CurrentPeers &peers);
 
+      /**
+       * Move the collected batches of every destination to requests.
+       * buffer_mutex_ must be locked
+       */
+      void takeBuffers(std::vector<Request> &requests);
+
+      /**
+       * Pass the batches to the connections. mutex_ must be locked
+       */
+      void send(std::vector<Request> requests);
+
+      /// Send the batches collected during the window
+      void flush();
+
       logger::LoggerPtr log_;
       std::shared_ptr<transport::OdOsNotificationFactory> factory_;
+      const BatchForwardingConfig forwarding_;
       rxcpp::composite_subscription subscription_;
 
       CurrentConnections connections_;
 
       std::shared_timed_mutex mutex_;
       std::atomic_bool stop_requested_{false};
+
+      std::mutex buffer_mutex_;
+      std::vector<Destination> destinations_;
+      bool flush_scheduled_ = false;
+      /// forwarded batches and requests in the current round
+      size_t forwarded_batches_ = 0;
+      size_t forwarded_requests_ = 0;
+
+      rxcpp::composite_subscription flush_lifetime_;
+      rxcpp::schedulers::worker flush_worker_;
     };
 
   }  // namespace ordering
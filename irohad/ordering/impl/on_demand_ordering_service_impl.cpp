@@ -33,12 +33,14 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
     logger::LoggerPtr log,
-    size_t number_of_proposals)
+    size_t number_of_proposals,
+    std::shared_ptr<AdaptiveProposalController> proposal_controller)
     : transaction_limit_(transaction_limit),
       number_of_proposals_(number_of_proposals),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
       proposal_creation_strategy_(std::move(proposal_creation_strategy)),
+      proposal_controller_(std::move(proposal_controller)),
       log_(std::move(log)) {}
 
 // -------------------------| OnDemandOrderingService |-------------------------
@@ -56,8 +58,9 @@ void OnDemandOrderingServiceImpl::onCollaborationOutcome(
 void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
   auto unprocessed_batches =
       boost::adaptors::filter(batches, [this](const auto &batch) {
-        log_->debug("check batch {} for already processed transactions",
-                    batch->reducedHash().hex());
+        log_->debug(
+            "check batch {} for already processed transactions",
+            logger::lazy([&batch] { return batch->reducedHash().hex(); }));
         return not this->batchAlreadyProcessed(*batch);
       });
   std::for_each(
@@ -134,9 +137,17 @@ getTransactions(size_t requested_tx_amount,
 void OnDemandOrderingServiceImpl::packNextProposals(
     const consensus::Round &round) {
   if (not pending_batches_.empty()) {
+    auto transaction_limit = transaction_limit_;
+    if (proposal_controller_) {
+      size_t queue_depth = 0;
+      for (const auto &batch : pending_batches_) {
+        queue_depth += boost::size(batch->transactions());
+      }
+      transaction_limit = proposal_controller_->proposalSize(queue_depth);
+    }
     size_t discarded_txs_quantity;
     auto txs = getTransactions(
-        transaction_limit_, pending_batches_, discarded_txs_quantity);
+        transaction_limit, pending_batches_, discarded_txs_quantity);
     log_->debug("Discarded {} transactions", discarded_txs_quantity);
     auto now = iroha::time::now();
     // create proposals for the next commit and reject rounds
@@ -217,8 +228,9 @@ bool OnDemandOrderingServiceImpl::batchAlreadyProcessed(
   return std::any_of(
       tx_statuses->begin(), tx_statuses->end(), [this](const auto &tx_status) {
         if (iroha::ametsuchi::isAlreadyProcessed(tx_status)) {
-          log_->warn("Duplicate transaction: {}",
-                     iroha::ametsuchi::getHash(tx_status).hex());
+          log_->warn("Duplicate transaction: {}", logger::lazy([&tx_status] {
+                       return iroha::ametsuchi::getHash(tx_status).hex();
+                     }));
           return true;
         }
         return false;
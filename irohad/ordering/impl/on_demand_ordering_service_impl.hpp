@@ -17,6 +17,7 @@
 #include "multi_sig_transactions/hash.hpp"
 // TODO 2019-03-15 andrei: IR-403 Separate BatchHashEquality and MstState
 #include "multi_sig_transactions/state/mst_state.hpp"
+#include "ordering/impl/adaptive_proposal_controller.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/ordering_service_proposal_creation_strategy.hpp"
 
@@ -38,6 +39,9 @@ namespace iroha {
 
     class OnDemandOrderingServiceImpl : public OnDemandOrderingService {
      public:
+      /// number of stored proposals by default
+      static constexpr size_t kDefaultNumberOfProposals = 3;
+
       /**
        * Create on_demand ordering service with following options:
        * @param transaction_limit - number of maximum transactions in one
@@ -48,6 +52,8 @@ namespace iroha {
        * @param number_of_proposals - number of stored proposals, older will be
        * removed. Default value is 3
        * @param creation_strategy - provides a strategy for creating proposals
+       * @param proposal_controller - optional controller of the proposal
+       * size, transaction_limit is used when it is not set
        */
       OnDemandOrderingServiceImpl(
           size_t transaction_limit,
@@ -56,7 +62,9 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
           logger::LoggerPtr log,
-          size_t number_of_proposals = 3);
+          size_t number_of_proposals = kDefaultNumberOfProposals,
+          std::shared_ptr<AdaptiveProposalController> proposal_controller =
+              nullptr);
 
       // --------------------- | OnDemandOrderingService |_---------------------
 
@@ -135,6 +143,11 @@ namespace iroha {
        */
       std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy_;
 
+      /**
+       * Controller of the proposal size, optional
+       */
+      std::shared_ptr<AdaptiveProposalController> proposal_controller_;
+
       /**
        * Logger instance
        */
@@ -18,6 +18,7 @@ using namespace iroha::ordering::transport;
 
 OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
+    std::string peer_address,
     std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
         async_call,
     std::shared_ptr<TransportFactoryType> proposal_factory,
@@ -26,6 +27,7 @@ OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     logger::LoggerPtr log)
     : log_(std::move(log)),
       stub_(std::move(stub)),
+      peer_address_(std::move(peer_address)),
       async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(std::move(time_provider)),
@@ -43,7 +45,7 @@ void OnDemandOsClientGrpc::onBatches(CollectionType batches) {
 
   log_->debug("Propagating: '{}'", request.DebugString());
 
-  async_call_->Call([&](auto context, auto cq) {
+  async_call_->CallPeer(peer_address_, [&](auto context, auto cq) {
     return stub_->AsyncSendBatches(context, request, cq);
   });
 }
@@ -95,6 +97,7 @@ std::unique_ptr<OdOsNotification> OnDemandOsClientGrpcFactory::create(
     const shared_model::interface::Peer &to) {
   return std::make_unique<OnDemandOsClientGrpc>(
       network::createClient<proto::OnDemandOrdering>(to.address()),
+      to.address(),
       async_call_,
       proposal_factory_,
       time_provider_,
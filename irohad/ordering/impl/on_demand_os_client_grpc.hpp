@@ -35,6 +35,7 @@ namespace iroha {
          */
         OnDemandOsClientGrpc(
             std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
+            std::string peer_address,
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::shared_ptr<TransportFactoryType> proposal_factory,
@@ -50,6 +51,7 @@ namespace iroha {
        private:
         logger::LoggerPtr log_;
         std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub_;
+        std::string peer_address_;
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call_;
         std::shared_ptr<TransportFactoryType> proposal_factory_;
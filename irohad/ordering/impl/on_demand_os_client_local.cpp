@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/on_demand_os_client_local.hpp"
+
+#include <boost/algorithm/string/predicate.hpp>
+#include "interfaces/common_objects/peer.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace iroha::ordering::transport;
+
+OnDemandOsClientLocal::OnDemandOsClientLocal(
+    std::shared_ptr<OnDemandOrderingService> ordering_service)
+    : ordering_service_(std::move(ordering_service)) {}
+
+void OnDemandOsClientLocal::onBatches(CollectionType batches) {
+  ordering_service_->onBatches(std::move(batches));
+}
+
+boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+OnDemandOsClientLocal::onRequestProposal(consensus::Round round) {
+  return ordering_service_->onRequestProposal(round);
+}
+
+OnDemandOsClientLocalFactory::OnDemandOsClientLocalFactory(
+    std::shared_ptr<OnDemandOrderingService> ordering_service,
+    std::string public_key,
+    std::shared_ptr<OdOsNotificationFactory> remote_factory)
+    : ordering_service_(std::move(ordering_service)),
+      public_key_(std::move(public_key)),
+      remote_factory_(std::move(remote_factory)) {}
+
+std::unique_ptr<OdOsNotification> OnDemandOsClientLocalFactory::create(
+    const shared_model::interface::Peer &to) {
+  if (boost::algorithm::iequals(to.pubkey(), public_key_)) {
+    return std::make_unique<OnDemandOsClientLocal>(ordering_service_);
+  }
+  return remote_factory_->create(to);
+}
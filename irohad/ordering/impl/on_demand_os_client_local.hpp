@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ON_DEMAND_OS_CLIENT_LOCAL_HPP
+#define IROHA_ON_DEMAND_OS_CLIENT_LOCAL_HPP
+
+#include "ordering/on_demand_os_transport.hpp"
+
+#include "ordering/on_demand_ordering_service.hpp"
+
+namespace iroha {
+  namespace ordering {
+    namespace transport {
+
+      /**
+       * Client for the ordering service of this peer, which passes the
+       * requests to it directly instead of a network round trip
+       */
+      class OnDemandOsClientLocal : public OdOsNotification {
+       public:
+        explicit OnDemandOsClientLocal(
+            std::shared_ptr<OnDemandOrderingService> ordering_service);
+
+        void onBatches(CollectionType batches) override;
+
+        boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
+            consensus::Round round) override;
+
+       private:
+        std::shared_ptr<OnDemandOrderingService> ordering_service_;
+      };
+
+      /**
+       * Creates local clients for the peer with the given public key, and
+       * clients of the given factory for other peers
+       */
+      class OnDemandOsClientLocalFactory : public OdOsNotificationFactory {
+       public:
+        OnDemandOsClientLocalFactory(
+            std::shared_ptr<OnDemandOrderingService> ordering_service,
+            std::string public_key,
+            std::shared_ptr<OdOsNotificationFactory> remote_factory);
+
+        std::unique_ptr<OdOsNotification> create(
+            const shared_model::interface::Peer &to) override;
+
+       private:
+        std::shared_ptr<OnDemandOrderingService> ordering_service_;
+        std::string public_key_;
+        std::shared_ptr<OdOsNotificationFactory> remote_factory_;
+      };
+
+    }  // namespace transport
+  }    // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ON_DEMAND_OS_CLIENT_LOCAL_HPP
@@ -5,6 +5,7 @@
 
 #include "pending_txs_storage/impl/pending_txs_storage_impl.hpp"
 
+#include <boost/assert.hpp>
 #include "ametsuchi/tx_presence_cache_utils.hpp"
 #include "interfaces/transaction.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
@@ -83,9 +84,10 @@ namespace iroha {
   PendingTransactionStorageImpl::SharedTxsCollectionType
   PendingTransactionStorageImpl::getPendingTransactions(
       const AccountIdType &account_id) const {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    auto account_batches_iterator = storage_.find(account_id);
-    if (storage_.end() != account_batches_iterator) {
+    const auto &shard = accountsShard(account_id);
+    std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+    auto account_batches_iterator = shard.accounts.find(account_id);
+    if (shard.accounts.end() != account_batches_iterator) {
       SharedTxsCollectionType result;
       for (const auto &batch : account_batches_iterator->second.batches) {
         auto &txs = batch->transactions();
@@ -104,9 +106,10 @@ namespace iroha {
       const std::optional<shared_model::interface::types::HashType>
           &first_tx_hash) const {
     BOOST_ASSERT_MSG(page_size > 0, "Page size has to be positive");
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    auto account_batches_iterator = storage_.find(account_id);
-    if (storage_.end() == account_batches_iterator) {
+    const auto &shard = accountsShard(account_id);
+    std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+    auto account_batches_iterator = shard.accounts.find(account_id);
+    if (shard.accounts.end() == account_batches_iterator) {
       if (first_tx_hash) {
         return iroha::expected::makeError(
             PendingTransactionStorage::ErrorCode::kNotFound);
@@ -160,10 +163,42 @@ namespace iroha {
     return creators;
   }
 
+  PendingTransactionStorageImpl::AccountsShard &
+  PendingTransactionStorageImpl::accountsShard(
+      const AccountIdType &account_id) {
+    return accounts_shards_[std::hash<AccountIdType>{}(account_id)
+                            % kShardsCount];
+  }
+
+  const PendingTransactionStorageImpl::AccountsShard &
+  PendingTransactionStorageImpl::accountsShard(
+      const AccountIdType &account_id) const {
+    return accounts_shards_[std::hash<AccountIdType>{}(account_id)
+                            % kShardsCount];
+  }
+
+  PendingTransactionStorageImpl::TransactionsShard &
+  PendingTransactionStorageImpl::transactionsShard(const HashType &hash) {
+    return transactions_shards_[HashType::Hasher{}(hash) % kShardsCount];
+  }
+
+  std::vector<std::unique_lock<std::shared_timed_mutex>>
+  PendingTransactionStorageImpl::lockAccounts(
+      const std::set<AccountIdType> &accounts) {
+    std::set<AccountsShard *> shards;
+    for (const auto &account_id : accounts) {
+      shards.insert(&accountsShard(account_id));
+    }
+    std::vector<std::unique_lock<std::shared_timed_mutex>> locks;
+    locks.reserve(shards.size());
+    for (auto shard : shards) {
+      locks.emplace_back(shard->mutex);
+    }
+    return locks;
+  }
+
   void PendingTransactionStorageImpl::updatedBatchesHandler(
       const SharedState &updated_batches) {
-    // need to test performance somehow - where to put the lock
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
     updated_batches->iterateBatches([this](const auto &batch) {
       if (isReplay(*batch)) {
         return;
@@ -172,16 +207,11 @@ namespace iroha {
       auto first_tx_hash = batch->transactions().front()->hash();
       auto batch_creators = batchCreators(*batch);
       auto batch_size = batch->transactions().size();
+      // only the shards of the creators of the batch are locked, so updates
+      // of batches of other accounts go in parallel
+      auto locks = lockAccounts(batch_creators);
       for (const auto &creator : batch_creators) {
-        auto account_batches_iterator = storage_.find(creator);
-        if (storage_.end() == account_batches_iterator) {
-          auto insertion_result = storage_.emplace(
-              creator, PendingTransactionStorageImpl::AccountBatches{});
-          BOOST_ASSERT(insertion_result.second);
-          account_batches_iterator = insertion_result.first;
-        }
-
-        auto &account_batches = account_batches_iterator->second;
+        auto &account_batches = accountsShard(creator).accounts[creator];
         auto index_iterator = account_batches.index.find(first_tx_hash);
         if (index_iterator == account_batches.index.end()) {
           // inserting the batch
@@ -190,15 +220,17 @@ namespace iroha {
           auto inserted_batch_iterator =
               std::prev(account_batches.batches.end());
           account_batches.index.emplace(first_tx_hash, inserted_batch_iterator);
-          for (auto &tx : batch->transactions()) {
-            account_batches.txs_to_batches.insert({tx->hash(), batch});
-          }
         } else {
           // updating batch
           auto &account_batch = index_iterator->second;
           *account_batch = batch;
         }
       }
+      for (auto &tx : batch->transactions()) {
+        auto &shard = transactionsShard(tx->hash());
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.batches[tx->hash()] = batch;
+      }
     });
   }
 
@@ -229,81 +261,82 @@ namespace iroha {
       const HashType &first_tx_hash,
       const std::set<AccountIdType> &batch_creators,
       uint64_t batch_size) {
-    // outer scope has to acquire unique lock over mutex_
+    // outer scope has to lock the shards of the creators
+    SharedBatch removed_batch;
     for (const auto &creator : batch_creators) {
-      auto account_batches_iterator = storage_.find(creator);
-      if (account_batches_iterator != storage_.end()) {
+      auto &accounts = accountsShard(creator).accounts;
+      auto account_batches_iterator = accounts.find(creator);
+      if (account_batches_iterator != accounts.end()) {
         auto &account_batches = account_batches_iterator->second;
         auto index_iterator = account_batches.index.find(first_tx_hash);
         if (index_iterator != account_batches.index.end()) {
           auto &batch_iterator = index_iterator->second;
           BOOST_ASSERT(batch_iterator != account_batches.batches.end());
-          account_batches.txs_to_batches.right.erase(*batch_iterator);
+          removed_batch = *batch_iterator;
           account_batches.batches.erase(batch_iterator);
           account_batches.index.erase(index_iterator);
           account_batches.all_transactions_quantity -= batch_size;
         }
         if (0 == account_batches.all_transactions_quantity) {
-          storage_.erase(account_batches_iterator);
+          accounts.erase(account_batches_iterator);
         }
       }
     }
+    if (removed_batch) {
+      for (auto &tx : removed_batch->transactions()) {
+        auto &shard = transactionsShard(tx->hash());
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.batches.erase(tx->hash());
+      }
+    }
   }
 
   void PendingTransactionStorageImpl::removeBatch(const SharedBatch &batch) {
     auto creators = batchCreators(*batch);
     auto first_tx_hash = batch->transactions().front()->hash();
     auto batch_size = batch->transactions().size();
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    auto locks = lockAccounts(creators);
     removeFromStorage(first_tx_hash, creators, batch_size);
   }
 
   void PendingTransactionStorageImpl::removeBatch(
       const PreparedTransactionDescriptor &prepared_transaction) {
-    boost::optional<std::set<AccountIdType>> creators = boost::none;
-    boost::optional<uint64_t> batch_size = boost::none;
+    SharedBatch batch;
     auto &creator_id = prepared_transaction.first;
     auto &first_transaction_hash = prepared_transaction.second;
     {
-      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-      auto account_batches_iterator = storage_.find(creator_id);
-      if (account_batches_iterator != storage_.end()) {
+      const auto &shard = accountsShard(creator_id);
+      std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+      auto account_batches_iterator = shard.accounts.find(creator_id);
+      if (account_batches_iterator != shard.accounts.end()) {
         auto &account_batches = account_batches_iterator->second;
         auto index_iterator =
             account_batches.index.find(first_transaction_hash);
         if (index_iterator != account_batches.index.end()) {
           auto &batch_iterator = index_iterator->second;
           BOOST_ASSERT(batch_iterator != account_batches.batches.end());
-          creators = batchCreators(**batch_iterator);
-          batch_size = boost::size((*batch_iterator)->transactions());
+          batch = *batch_iterator;
         }
       }
     }
-    if (creators and batch_size) {
-      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-      removeFromStorage(first_transaction_hash, *creators, *batch_size);
+    if (batch) {
+      removeBatch(batch);
     }
   }
 
   void PendingTransactionStorageImpl::removeTransaction(HashType const &hash) {
-    std::shared_lock<std::shared_timed_mutex> read_lock(mutex_);
-    for (auto &p : storage_) {
-      auto &txs_index = p.second.txs_to_batches;
-      auto it = txs_index.left.find(hash);
-      if (txs_index.left.end() != it) {
-        auto batch = it->second;
-        assert(!!batch);
-
-        auto const &transactions = batch->transactions();
-        auto const &first_transaction_hash = transactions.front()->hash();
-        auto const &creators = batchCreators(*batch);
-        auto batch_size = transactions.size();
-        read_lock.unlock();
-        std::unique_lock<std::shared_timed_mutex> write_lock(mutex_);
-        removeFromStorage(first_transaction_hash, creators, batch_size);
+    SharedBatch batch;
+    {
+      auto &shard = transactionsShard(hash);
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto it = shard.batches.find(hash);
+      if (shard.batches.end() == it) {
         return;
       }
+      batch = it->second;
     }
+    assert(!!batch);
+    removeBatch(batch);
   }
 
 }  // namespace iroha
@@ -8,19 +8,18 @@
 
 #include "pending_txs_storage/pending_txs_storage.hpp"
 
+#include <array>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
-#include <boost/bimap.hpp>
-#include <boost/bimap/unordered_multiset_of.hpp>
-#include <boost/bimap/unordered_set_of.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "cryptography/hash.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
-#include "multi_sig_transactions/hash.hpp"
 
 namespace iroha {
 
@@ -78,6 +77,13 @@ namespace iroha {
 
     void removeBatch(const PreparedTransactionDescriptor &prepared_transaction);
 
+    /**
+     * Remove the batch from the storages of its creators
+     * @param first_tx_hash - hash of the first transaction of the batch
+     * @param batch_creators - creators of the transactions of the batch
+     * @param batch_size - number of transactions of the batch
+     * Outer scope has to lock the shards of the creators.
+     */
     void removeFromStorage(const HashType &first_tx_hash,
                            const std::set<AccountIdType> &batch_creators,
                            uint64_t batch_size);
@@ -90,18 +96,14 @@ namespace iroha {
 
     std::weak_ptr<ametsuchi::TxPresenceCache> presence_cache_;
 
-    /**
-     * Mutex for single-write multiple-read storage access
-     */
-    mutable std::shared_timed_mutex mutex_;
-
     /**
      * The struct represents an indexed storage of pending transactions or
      * batches for a SINGLE account.
      *
      * "batches" field contains pointers to all pending batches associated with
      * an account. Use of std::list allows us to automatically preserve their
-     * mutual order.
+     * mutual order, and its iterators stay valid while other batches are
+     * inserted or removed, so a page cursor resolves to its batch in O(1).
      *
      * "index" map allows performing random access to "batches" list. Thus, we
      * can access any batch within the list in the most optimal way.
@@ -111,27 +113,51 @@ namespace iroha {
      */
     struct AccountBatches {
       using BatchPtr = std::shared_ptr<TransactionBatch>;
-      using BatchesBimap = boost::bimap<
-          boost::bimaps::unordered_set_of<HashType,
-                                          shared_model::crypto::Hash::Hasher>,
-          boost::bimaps::unordered_multiset_of<
-              BatchPtr,
-              iroha::model::PointerBatchHasher,
-              shared_model::interface::BatchHashEquality>>;
 
       std::list<BatchPtr> batches;
       std::
           unordered_map<HashType, decltype(batches)::iterator, HashType::Hasher>
               index;
-      BatchesBimap txs_to_batches;
 
       uint64_t all_transactions_quantity{0};
     };
 
     /**
-     * Maps account names with its storages of pending transactions or batches.
+     * Storages of pending batches of the accounts which hash to the shard,
+     * with the mutex for single-write multiple-read access to them
+     */
+    struct AccountsShard {
+      mutable std::shared_timed_mutex mutex;
+      std::unordered_map<AccountIdType, AccountBatches> accounts;
+    };
+
+    /**
+     * Pending batches by hashes of their transactions, which hash to the
+     * shard, for removal of a batch by any of its transactions
      */
-    std::unordered_map<AccountIdType, AccountBatches> storage_;
+    struct TransactionsShard {
+      std::mutex mutex;
+      std::unordered_map<HashType, SharedBatch, HashType::Hasher> batches;
+    };
+
+    /// number of shards of the accounts and of the transactions
+    static constexpr size_t kShardsCount = 16;
+
+    AccountsShard &accountsShard(const AccountIdType &account_id);
+
+    const AccountsShard &accountsShard(const AccountIdType &account_id) const;
+
+    TransactionsShard &transactionsShard(const HashType &hash);
+
+    /**
+     * Lock the shards of the accounts in the order of the shards, so that
+     * updates of batches of several creators do not deadlock
+     */
+    std::vector<std::unique_lock<std::shared_timed_mutex>> lockAccounts(
+        const std::set<AccountIdType> &accounts);
+
+    std::array<AccountsShard, kShardsCount> accounts_shards_;
+    std::array<TransactionsShard, kShardsCount> transactions_shards_;
   };
 
 }  // namespace iroha
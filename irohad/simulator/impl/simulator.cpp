@@ -35,8 +35,11 @@ namespace iroha {
       ordering_gate->onProposal().subscribe(
           proposal_subscription_, [this](const network::OrderingEvent &event) {
             if (event.proposal) {
+              auto proposal = getProposalUnsafe(event);
+              this->speculateBlock(proposal,
+                                   event.ledger_state->top_block_info);
               auto validated_proposal_and_errors =
-                  this->processProposal(*getProposalUnsafe(event));
+                  this->processProposal(*proposal);
 
               notifier_.get_subscriber().on_next(
                   VerifiedProposalCreatorEvent{validated_proposal_and_errors,
@@ -103,22 +106,69 @@ namespace iroha {
       log_->info("process verified proposal");
 
       const auto &proposal = verified_proposal_and_errors->verified_proposal;
+      if (auto block = takeSpeculativeBlock(*proposal, top_block_info)) {
+        log_->debug("using the speculative block");
+        return block;
+      }
+
       std::vector<shared_model::crypto::Hash> rejected_hashes;
       for (const auto &rejected_tx :
            verified_proposal_and_errors->rejected_transactions) {
         rejected_hashes.push_back(rejected_tx.tx_hash);
       }
+      return createBlock(
+          *proposal, std::move(rejected_hashes), top_block_info);
+    }
+
+    std::shared_ptr<shared_model::interface::Block> Simulator::createBlock(
+        const shared_model::interface::Proposal &proposal,
+        std::vector<shared_model::crypto::Hash> rejected_hashes,
+        const TopBlockInfo &top_block_info) const {
       std::shared_ptr<shared_model::interface::Block> block =
           block_factory_->unsafeCreateBlock(top_block_info.height + 1,
                                             top_block_info.top_hash,
-                                            proposal->createdTime(),
-                                            proposal->transactions(),
+                                            proposal.createdTime(),
+                                            proposal.transactions(),
                                             rejected_hashes);
       crypto_signer_->sign(*block);
-
       return block;
     }
 
+    void Simulator::speculateBlock(
+        std::shared_ptr<const shared_model::interface::Proposal> proposal,
+        const TopBlockInfo &top_block_info) {
+      // a speculation left from a proposal without a block is discarded
+      speculative_block_ = boost::none;
+      auto proposal_hash = proposal->hash();
+      speculative_block_ = SpeculativeBlock{
+          std::move(proposal_hash),
+          top_block_info.top_hash,
+          std::async(std::launch::async,
+                     [this, proposal = std::move(proposal), top_block_info] {
+                       return createBlock(*proposal, {}, top_block_info);
+                     })};
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Block>>
+    Simulator::takeSpeculativeBlock(
+        const shared_model::interface::Proposal &proposal,
+        const TopBlockInfo &top_block_info) {
+      if (not speculative_block_) {
+        return boost::none;
+      }
+      auto speculation = std::move(*speculative_block_);
+      speculative_block_ = boost::none;
+      // the hash of the verified proposal differs if any transaction has been
+      // rejected
+      if (speculation.proposal_hash != proposal.hash()
+          or speculation.top_hash != top_block_info.top_hash) {
+        log_->debug("discarding the speculative block");
+        // the destructor of the future waits for the speculation to finish
+        return boost::none;
+      }
+      return speculation.block.get();
+    }
+
     rxcpp::observable<BlockCreatorEvent> Simulator::onBlock() {
       return block_notifier_.get_observable();
     }
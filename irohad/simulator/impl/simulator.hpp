@@ -9,6 +9,8 @@
 #include "simulator/block_creator.hpp"
 #include "simulator/verified_proposal_creator.hpp"
 
+#include <future>
+
 #include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/temporary_factory.hpp"
@@ -59,6 +61,37 @@ namespace iroha {
       rxcpp::observable<BlockCreatorEvent> onBlock() override;
 
      private:
+      /**
+       * Block of a proposal, which is created and signed while the proposal
+       * is validated on the assumption that none of its transactions is
+       * rejected
+       */
+      struct SpeculativeBlock {
+        shared_model::crypto::Hash proposal_hash;
+        shared_model::crypto::Hash top_hash;
+        std::future<std::shared_ptr<shared_model::interface::Block>> block;
+      };
+
+      /// Create and sign the block of the proposal
+      std::shared_ptr<shared_model::interface::Block> createBlock(
+          const shared_model::interface::Proposal &proposal,
+          std::vector<shared_model::crypto::Hash> rejected_hashes,
+          const TopBlockInfo &top_block_info) const;
+
+      /// Start creation of the speculative block of the proposal
+      void speculateBlock(
+          std::shared_ptr<const shared_model::interface::Proposal> proposal,
+          const TopBlockInfo &top_block_info);
+
+      /**
+       * Take the speculative block if it is created for the given verified
+       * proposal, which is the case when no transaction has been rejected, so
+       * the verified proposal equals to the proposal
+       */
+      boost::optional<std::shared_ptr<shared_model::interface::Block>>
+      takeSpeculativeBlock(const shared_model::interface::Proposal &proposal,
+                           const TopBlockInfo &top_block_info);
+
       // internal
       std::shared_ptr<iroha::ametsuchi::CommandExecutor> command_executor_;
 
@@ -76,6 +109,8 @@ namespace iroha {
       std::unique_ptr<shared_model::interface::UnsafeBlockFactory>
           block_factory_;
 
+      boost::optional<SpeculativeBlock> speculative_block_;
+
       logger::LoggerPtr log_;
     };
   }  // namespace simulator
@@ -10,6 +10,7 @@
 #include <rxcpp/operators/rx-tap.hpp>
 #include "ametsuchi/block_query_factory.hpp"
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "common/bind.hpp"
 #include "common/visitor.hpp"
@@ -113,7 +114,15 @@ namespace iroha {
                     my_height = block->height();
                   });
 
-          if (validator_->validateAndApply(network_chain, *storage)) {
+          const bool applied =
+              validator_->validateAndApply(network_chain, *storage);
+          // blocks can be fetched ahead of their application, so the height
+          // of the last applied block is taken from the storage if possible
+          auto ledger_state = storage->getLedgerState();
+          if (ledger_state) {
+            my_height = ledger_state.value()->top_block_info.height;
+          }
+          if (applied) {
             if (my_height >= target_height) {
               // goto is alright to break out of nested loops:
               // https://isocpp.github.io/CppCoreGuidelines/CppCoreGuidelines#es76-avoid-goto
@@ -126,7 +135,9 @@ namespace iroha {
             }
           } else {
             // last block did not apply - need to ask it again from other peer
-            my_height = std::max(my_height - 1, start_height);
+            if (not ledger_state) {
+              my_height = std::max(my_height - 1, start_height);
+            }
             break;
           }
         }
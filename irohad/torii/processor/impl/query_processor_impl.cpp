@@ -6,6 +6,7 @@
 #include "torii/processor/query_processor_impl.hpp"
 
 #include <boost/range/size.hpp>
+#include "ametsuchi/ledger_state.hpp"
 #include "common/bind.hpp"
 #include "common/result.hpp"
 #include "interfaces/queries/blocks_query.hpp"
@@ -15,6 +16,17 @@
 #include "interfaces/query_responses/query_response.hpp"
 #include "logger/logger.hpp"
 
+namespace {
+  /// Maximum number of query responses kept for the current ledger height
+  constexpr size_t kMaxCachedResponses = 10000;
+
+  shared_model::interface::types::HeightType getLedgerHeight(
+      const iroha::ametsuchi::Storage &storage) {
+    auto ledger_state = storage.getLedgerState();
+    return ledger_state ? ledger_state.value()->top_block_info.height : 0;
+  }
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -29,9 +41,12 @@ namespace iroha {
           qry_exec_{std::move(qry_exec)},
           pending_transactions_{std::move(pending_transactions)},
           response_factory_{std::move(response_factory)},
-          log_{std::move(log)} {
+          log_{std::move(log)},
+          response_cache_{
+              getLedgerHeight(*storage_), kMaxCachedResponses, log_} {
       storage_->on_commit().subscribe(
           [this](std::shared_ptr<const shared_model::interface::Block> block) {
+            response_cache_.onCommit(*block);
             auto block_response =
                 response_factory_->createBlockQueryResponse(block);
             blocks_query_subject_.get_subscriber().on_next(
@@ -43,10 +58,20 @@ namespace iroha {
         std::unique_ptr<shared_model::interface::QueryResponse>,
         std::string>
     QueryProcessorImpl::queryHandle(const shared_model::interface::Query &qry) {
+      auto cache_key = QueryResponseCache::makeKey(qry);
+      if (cache_key) {
+        if (auto response = response_cache_.find(*cache_key, qry.hash())) {
+          return iroha::expected::makeValue(std::move(response));
+        }
+      }
       return qry_exec_->createQueryExecutor(pending_transactions_,
                                             response_factory_)
           | [&](auto &&executor) {
-              return executor->validateAndExecute(qry, true);
+              auto response = executor->validateAndExecute(qry, true);
+              if (cache_key) {
+                response_cache_.insert(std::move(*cache_key), qry, *response);
+              }
+              return response;
             };
     }
 
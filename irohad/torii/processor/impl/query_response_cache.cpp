@@ -0,0 +1,291 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/processor/query_response_cache.hpp"
+
+#include <ciso646>
+#include <unordered_set>
+
+#include <boost/range/size.hpp>
+#include "backend/protobuf/queries/proto_query.hpp"
+#include "backend/protobuf/query_responses/proto_query_response.hpp"
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/compare_and_set_account_detail.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/remove_peer.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/queries/get_account.hpp"
+#include "interfaces/queries/get_account_assets.hpp"
+#include "interfaces/queries/get_account_detail.hpp"
+#include "interfaces/queries/get_asset_info.hpp"
+#include "interfaces/queries/get_peers.hpp"
+#include "interfaces/queries/get_role_permissions.hpp"
+#include "interfaces/queries/get_roles.hpp"
+#include "interfaces/queries/get_signatories.hpp"
+#include "interfaces/queries/query.hpp"
+#include "interfaces/query_responses/error_query_response.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::torii;
+using namespace shared_model::interface;
+
+namespace {
+  /**
+   * Get the state a response to the query depends on
+   * @return the scope, or none if responses to the query are not cached
+   */
+  boost::optional<QueryResponseCache::Scope> getScope(const Query &query) {
+    using Scope = QueryResponseCache::Scope;
+    auto account_scope = [&query](const types::AccountIdType &account_id) {
+      return boost::make_optional(Scope{
+          Scope::Type::kAccount,
+          account_id.empty() ? query.creatorAccountId() : account_id});
+    };
+    return iroha::visit_in_place(
+        query.get(),
+        [&](const GetAccount &q) { return account_scope(q.accountId()); },
+        [&](const GetSignatories &q) { return account_scope(q.accountId()); },
+        [&](const GetAccountAssets &q) { return account_scope(q.accountId()); },
+        [&](const GetAccountDetail &q) { return account_scope(q.accountId()); },
+        [](const GetAssetInfo &q) {
+          return boost::make_optional(
+              Scope{Scope::Type::kAsset, q.assetId()});
+        },
+        [](const GetRoles &) {
+          return boost::make_optional(Scope{Scope::Type::kRoles, {}});
+        },
+        [](const GetRolePermissions &) {
+          return boost::make_optional(Scope{Scope::Type::kRoles, {}});
+        },
+        [](const GetPeers &) {
+          return boost::make_optional(Scope{Scope::Type::kPeers, {}});
+        },
+        [](const auto &) -> boost::optional<Scope> { return boost::none; });
+  }
+
+  /// State changed by a block, as far as the cached responses are concerned
+  struct BlockChanges {
+    std::unordered_set<std::string> accounts;
+    std::unordered_set<std::string> assets;
+    bool roles = false;
+    bool peers = false;
+    /// the block may have changed anything, e.g. permissions
+    bool everything = false;
+  };
+
+  BlockChanges getChanges(const Block &block) {
+    BlockChanges changes;
+    for (const auto &tx : block.transactions()) {
+      for (const auto &command : tx.commands()) {
+        iroha::visit_in_place(
+            command.get(),
+            [&](const AddAssetQuantity &) {
+              changes.accounts.insert(tx.creatorAccountId());
+            },
+            [&](const SubtractAssetQuantity &) {
+              changes.accounts.insert(tx.creatorAccountId());
+            },
+            [&](const TransferAsset &c) {
+              changes.accounts.insert(c.srcAccountId());
+              changes.accounts.insert(c.destAccountId());
+            },
+            [&](const SetAccountDetail &c) {
+              changes.accounts.insert(c.accountId());
+            },
+            [&](const CompareAndSetAccountDetail &c) {
+              changes.accounts.insert(c.accountId());
+            },
+            [&](const AddSignatory &c) {
+              changes.accounts.insert(c.accountId());
+            },
+            [&](const RemoveSignatory &c) {
+              changes.accounts.insert(c.accountId());
+            },
+            [&](const SetQuorum &c) { changes.accounts.insert(c.accountId()); },
+            [&](const CreateAccount &c) {
+              changes.accounts.insert(c.accountName() + "@" + c.domainId());
+            },
+            [&](const CreateAsset &c) {
+              changes.assets.insert(c.assetName() + "#" + c.domainId());
+            },
+            [&](const CreateDomain &) {},
+            [&](const CreateRole &) { changes.roles = true; },
+            [&](const AddPeer &) { changes.peers = true; },
+            [&](const RemovePeer &) { changes.peers = true; },
+            // roles and grants of accounts, settings and smart contracts
+            [&](const auto &) { changes.everything = true; });
+      }
+    }
+    return changes;
+  }
+
+  bool isChanged(const BlockChanges &changes,
+                 const types::AccountIdType &creator,
+                 const QueryResponseCache::Scope &scope) {
+    using Type = QueryResponseCache::Scope::Type;
+    if (changes.everything or changes.accounts.count(creator) != 0) {
+      return true;
+    }
+    switch (scope.type) {
+      case Type::kAccount:
+        return changes.accounts.count(scope.id) != 0;
+      case Type::kAsset:
+        return changes.assets.count(scope.id) != 0;
+      case Type::kRoles:
+        return changes.roles;
+      case Type::kPeers:
+        return changes.peers;
+    }
+    return true;
+  }
+}  // namespace
+
+QueryResponseCache::QueryResponseCache(types::HeightType height,
+                                       size_t max_size,
+                                       logger::LoggerPtr log)
+    : height_(height), max_size_(max_size), log_(std::move(log)) {}
+
+boost::optional<QueryResponseCache::Key> QueryResponseCache::makeKey(
+    const Query &query) {
+  if (not getScope(query)) {
+    return boost::none;
+  }
+  auto signatures = query.signatures();
+  if (boost::size(signatures) != 1) {
+    return boost::none;
+  }
+  auto payload =
+      static_cast<const shared_model::proto::Query &>(query).getTransport()
+          .payload();
+  // the creator stays in the key, the time and counter do not change the
+  // response
+  payload.mutable_meta()->clear_created_time();
+  payload.mutable_meta()->clear_query_counter();
+  return signatures.begin()->publicKey() + payload.SerializeAsString();
+}
+
+std::unique_ptr<QueryResponse> QueryResponseCache::find(
+    const Key &key, const types::HashType &query_hash) {
+  iroha::protocol::QueryResponse response;
+  {
+    // exclusive, since the hit moves the key in lru_
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      ++misses_;
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    response = it->second.response;
+  }
+  ++hits_;
+  response.set_query_hash(query_hash.hex());
+  return std::make_unique<shared_model::proto::QueryResponse>(
+      std::move(response));
+}
+
+void QueryResponseCache::insert(Key key,
+                                const Query &query,
+                                const QueryResponse &response) {
+  if (response.height() == 0
+      or iroha::visit_in_place(response.get(),
+                               [](const ErrorQueryResponse &) { return true; },
+                               [](const auto &) { return false; })) {
+    return;
+  }
+  auto scope = getScope(query);
+  if (not scope) {
+    return;
+  }
+
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  if (response.height() != height_ or max_size_ == 0) {
+    return;
+  }
+  // the same query may have been answered concurrently
+  auto existing = entries_.find(key);
+  if (existing != entries_.end()) {
+    erase(existing);
+  }
+  while (entries_.size() >= max_size_) {
+    erase(entries_.find(lru_.back()));
+    ++evictions_;
+  }
+  lru_.push_front(key);
+  entries_.emplace(
+      std::move(key),
+      Entry{static_cast<const shared_model::proto::QueryResponse &>(response)
+                .getTransport(),
+            query.creatorAccountId(),
+            std::move(*scope),
+            lru_.begin()});
+}
+
+void QueryResponseCache::erase(std::unordered_map<Key, Entry>::iterator it) {
+  lru_.erase(it->second.lru_position);
+  entries_.erase(it);
+}
+
+void QueryResponseCache::onCommit(const Block &block) {
+  auto changes = getChanges(block);
+
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  const auto previous_size = entries_.size();
+  if (block.height() != height_ + 1) {
+    entries_.clear();
+    lru_.clear();
+  } else {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (isChanged(changes, it->second.creator, it->second.scope)) {
+        lru_.erase(it->second.lru_position);
+        it = entries_.erase(it);
+      } else {
+        it->second.response.set_height(block.height());
+        ++it;
+      }
+    }
+  }
+  height_ = block.height();
+
+  log_->debug(
+      "Query responses at height {}: {} kept of {}, {} hits, {} misses, {} "
+      "evictions so far",
+      height_,
+      entries_.size(),
+      previous_size,
+      hits_.load(),
+      misses_.load(),
+      evictions_.load());
+}
+
+size_t QueryResponseCache::hits() const {
+  return hits_;
+}
+
+size_t QueryResponseCache::misses() const {
+  return misses_;
+}
+
+size_t QueryResponseCache::evictions() const {
+  return evictions_;
+}
+
+size_t QueryResponseCache::size() const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return entries_.size();
+}
@@ -12,6 +12,7 @@
 #include "ametsuchi/storage.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "torii/processor/query_response_cache.hpp"
 
 namespace iroha {
   namespace torii {
@@ -51,6 +52,8 @@ namespace iroha {
           response_factory_;
 
       logger::LoggerPtr log_;
+
+      QueryResponseCache response_cache_;
     };
 
   }  // namespace torii
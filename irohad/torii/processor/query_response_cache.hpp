@@ -0,0 +1,141 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_QUERY_RESPONSE_CACHE_HPP
+#define IROHA_QUERY_RESPONSE_CACHE_HPP
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+#include "qry_responses.pb.h"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+    class Query;
+    class QueryResponse;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Cache of responses to the queries which read the current state of
+     * accounts, assets, roles and peers. A response is valid for the ledger
+     * height it was made at. On commit of the next block only the responses
+     * depending on the accounts and assets changed by the block are dropped,
+     * and the rest are kept for the new height. When the cache is full, the
+     * least recently used response is evicted for a new one.
+     */
+    class QueryResponseCache {
+     public:
+      /// Query with its signature, creation time and counter stripped, and
+      /// the signatory, whose validity is a part of the response
+      using Key = std::string;
+
+      /// What a cached response depends on besides the query creator
+      struct Scope {
+        enum class Type { kAccount, kAsset, kRoles, kPeers };
+        Type type;
+        /// id of the account or asset, empty for roles and peers
+        std::string id;
+      };
+
+      /**
+       * @param height - current ledger height
+       * @param max_size - maximum number of cached responses, the least
+       * recently used ones are evicted above it
+       * @param log - logger
+       */
+      QueryResponseCache(shared_model::interface::types::HeightType height,
+                         size_t max_size,
+                         logger::LoggerPtr log);
+
+      /**
+       * Make the key of the query
+       * @return the key, or none if responses to the query are not cached
+       */
+      static boost::optional<Key> makeKey(
+          const shared_model::interface::Query &query);
+
+      /**
+       * Find the response to the query made at the current ledger height and
+       * mark it as the most recently used
+       * @param key - key of the query
+       * @param query_hash - hash of the query to put to the response
+       * @return copy of the cached response, or nullptr if there is none
+       */
+      std::unique_ptr<shared_model::interface::QueryResponse> find(
+          const Key &key,
+          const shared_model::interface::types::HashType &query_hash);
+
+      /**
+       * Store the response to the query, if it is made at the current ledger
+       * height and is not an error, evicting the least recently used response
+       * if the cache is full
+       * @param key - key of the query
+       * @param query - the query
+       * @param response - response to the query
+       */
+      void insert(Key key,
+                  const shared_model::interface::Query &query,
+                  const shared_model::interface::QueryResponse &response);
+
+      /**
+       * Move the cache to the height of the committed block, dropping the
+       * responses that the block may have changed
+       */
+      void onCommit(const shared_model::interface::Block &block);
+
+      /// @return number of queries answered from the cache
+      size_t hits() const;
+
+      /// @return number of cacheable queries not found in the cache
+      size_t misses() const;
+
+      /// @return number of responses evicted to make room for new ones
+      size_t evictions() const;
+
+      /// @return number of cached responses
+      size_t size() const;
+
+     private:
+      struct Entry {
+        iroha::protocol::QueryResponse response;
+        shared_model::interface::types::AccountIdType creator;
+        Scope scope;
+        /// position of the key in lru_
+        std::list<Key>::iterator lru_position;
+      };
+
+      /// Drop the entry together with its key in lru_
+      void erase(std::unordered_map<Key, Entry>::iterator it);
+
+      mutable std::shared_timed_mutex mutex_;
+      std::unordered_map<Key, Entry> entries_;
+      /// keys of the entries, the most recently used first
+      std::list<Key> lru_;
+      shared_model::interface::types::HeightType height_;
+      const size_t max_size_;
+
+      std::atomic<size_t> hits_{0};
+      std::atomic<size_t> misses_{0};
+      std::atomic<size_t> evictions_{0};
+
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // IROHA_QUERY_RESPONSE_CACHE_HPP
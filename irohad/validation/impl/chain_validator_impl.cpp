@@ -5,7 +5,16 @@
 
 #include "validation/impl/chain_validator_impl.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <thread>
+
 #include <boost/algorithm/string/join.hpp>
+#include <boost/optional.hpp>
+#include <boost/range/adaptor/transformed.hpp>
+#include <boost/range/size.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/mutable_storage.hpp"
@@ -13,15 +22,81 @@
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
-#include "validation/utils.hpp"
+
+namespace {
+  /**
+   * Bounded single producer single consumer queue. Closing the queue wakes
+   * both sides up and makes further pushes fail. The producer may close the
+   * queue with an error, which the consumer gets after the queue is drained
+   */
+  template <typename T>
+  class PrefetchQueue {
+   public:
+    explicit PrefetchQueue(size_t capacity) : capacity_(capacity) {}
+
+    /// @return false if the queue was closed
+    bool push(T item) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_full_.wait(lock,
+                     [this] { return closed_ or items_.size() < capacity_; });
+      if (closed_) {
+        return false;
+      }
+      items_.push_back(std::move(item));
+      not_empty_.notify_one();
+      return true;
+    }
+
+    /// @return next item or none if the queue is closed and drained
+    boost::optional<T> pop() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_empty_.wait(lock, [this] { return closed_ or not items_.empty(); });
+      if (items_.empty()) {
+        return boost::none;
+      }
+      auto item = std::move(items_.front());
+      items_.pop_front();
+      not_full_.notify_one();
+      return item;
+    }
+
+    void close(std::exception_ptr error = nullptr) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      if (not error_) {
+        error_ = std::move(error);
+      }
+      not_full_.notify_all();
+      not_empty_.notify_all();
+    }
+
+    /// @return error the queue was closed with, if any
+    std::exception_ptr error() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return error_;
+    }
+
+   private:
+    const size_t capacity_;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::deque<T> items_;
+    bool closed_ = false;
+    std::exception_ptr error_;
+  };
+}  // namespace
 
 namespace iroha {
   namespace validation {
     ChainValidatorImpl::ChainValidatorImpl(
         std::shared_ptr<consensus::yac::SupermajorityChecker>
             supermajority_checker,
+        std::shared_ptr<consensus::ConsensusResultCache> block_cache,
         logger::LoggerPtr log)
-        : supermajority_checker_(supermajority_checker), log_(std::move(log)) {}
+        : supermajority_checker_(supermajority_checker),
+          block_cache_(std::move(block_cache)),
+          log_(std::move(log)) {}
 
     bool ChainValidatorImpl::validateAndApply(
         rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
@@ -29,10 +104,119 @@ namespace iroha {
         ametsuchi::MutableStorage &storage) const {
       log_->info("validate chain...");
 
-      return storage.apply(blocks,
-                           [this](auto block, const auto &ledger_state) {
-                             return this->validateBlock(block, ledger_state);
-                           });
+      std::shared_ptr<const PeerKeys> initial_keys;
+      if (auto ledger_state = storage.getLedgerState()) {
+        initial_keys = getPeerKeys(ledger_state.value()->ledger_peers);
+      }
+
+      PrefetchQueue<PrefetchedBlock> queue(kPrefetchDepth);
+      rxcpp::composite_subscription fetching;
+      std::thread prefetch_thread([&] {
+        blocks.subscribe(
+            fetching,
+            [&](std::shared_ptr<shared_model::interface::Block> block) {
+              block = this->fromCache(std::move(block));
+              PrefetchedBlock prefetched{block, initial_keys, false};
+              if (initial_keys) {
+                prefetched.signed_by_peers =
+                    this->signedByPeers(*block, *initial_keys);
+              }
+              if (not queue.push(std::move(prefetched))) {
+                fetching.unsubscribe();
+              }
+            },
+            [&](std::exception_ptr error) { queue.close(error); },
+            [&] { queue.close(); });
+      });
+      // the block stream is unsubscribed as well, so that the prefetch thread
+      // does not wait for a block nobody needs when the application stops
+      // before the end of the stream
+      auto stop_prefetch = [&] {
+        fetching.unsubscribe();
+        queue.close();
+        prefetch_thread.join();
+      };
+
+      boost::optional<PrefetchedBlock> current;
+      auto prefetched_blocks =
+          rxcpp::observable<>::create<
+              std::shared_ptr<shared_model::interface::Block>>(
+              [&](auto subscriber) {
+                while (subscriber.is_subscribed() and (current = queue.pop())) {
+                  subscriber.on_next(current->block);
+                }
+                if (auto error = queue.error()) {
+                  subscriber.on_error(error);
+                } else {
+                  subscriber.on_completed();
+                }
+              });
+
+      bool result;
+      try {
+        result = storage.apply(
+            prefetched_blocks, [&](auto block, const auto &ledger_state) {
+              const auto prefetched =
+                  current and current->block == block ? &*current : nullptr;
+              return this->validateBlock(block, prefetched, ledger_state);
+            });
+      } catch (...) {
+        stop_prefetch();
+        throw;
+      }
+
+      stop_prefetch();
+      return result;
+    }
+
+    std::shared_ptr<const ChainValidatorImpl::PeerKeys>
+    ChainValidatorImpl::getPeerKeys(
+        const shared_model::interface::types::PeerList &peers) const {
+      std::lock_guard<std::mutex> lock(peer_keys_mutex_);
+      if (not peer_keys_
+          or not std::equal(peer_keys_->ordered.begin(),
+                            peer_keys_->ordered.end(),
+                            peers.begin(),
+                            peers.end(),
+                            [](const auto &key, const auto &peer) {
+                              return key == peer->pubkey();
+                            })) {
+        auto keys = std::make_shared<PeerKeys>();
+        keys->ordered.reserve(peers.size());
+        for (const auto &peer : peers) {
+          keys->ordered.push_back(peer->pubkey());
+        }
+        keys->sorted = keys->ordered;
+        std::sort(keys->sorted.begin(), keys->sorted.end());
+        peer_keys_ = std::move(keys);
+      }
+      return peer_keys_;
+    }
+
+    std::shared_ptr<shared_model::interface::Block>
+    ChainValidatorImpl::fromCache(
+        std::shared_ptr<shared_model::interface::Block> block) const {
+      if (block_cache_) {
+        auto cached_block = block_cache_->get();
+        if (cached_block and cached_block->hash() == block->hash()) {
+          log_->debug("block {} is taken from consensus cache",
+                      block->hash().hex());
+          return cached_block;
+        }
+      }
+      return block;
+    }
+
+    bool ChainValidatorImpl::signedByPeers(
+        const shared_model::interface::Block &block,
+        const PeerKeys &keys) const {
+      const auto &signatures = block.signatures();
+      return std::all_of(
+          signatures.begin(), signatures.end(), [&keys](const auto &signature) {
+            return std::binary_search(keys.sorted.begin(),
+                                      keys.sorted.end(),
+                                      signature.publicKey());
+          });
     }
 
     bool ChainValidatorImpl::validatePreviousHash(
@@ -69,12 +253,19 @@ namespace iroha {
 
     bool ChainValidatorImpl::validatePeerSupermajority(
         const shared_model::interface::Block &block,
-        const std::vector<std::shared_ptr<shared_model::interface::Peer>>
-            &peers) const {
+        const PrefetchedBlock *prefetched,
+        const shared_model::interface::types::PeerList &peers) const {
       const auto &signatures = block.signatures();
+      const auto signed_by_peers = [&] {
+        auto keys = getPeerKeys(peers);
+        if (prefetched and prefetched->checked_keys == keys) {
+          return prefetched->signed_by_peers;
+        }
+        return signedByPeers(block, *keys);
+      };
       auto has_supermajority = supermajority_checker_->hasSupermajority(
                                    boost::size(signatures), peers.size())
-          and peersSubset(signatures, peers);
+          and signed_by_peers();
 
       if (not has_supermajority) {
         log_->info(
@@ -98,6 +289,7 @@ namespace iroha {
 
     bool ChainValidatorImpl::validateBlock(
         std::shared_ptr<const shared_model::interface::Block> block,
+        const PrefetchedBlock *prefetched,
         const iroha::LedgerState &ledger_state) const {
       log_->debug("validate block: height {}, hash {}",
                   block->height(),
@@ -105,7 +297,8 @@ namespace iroha {
 
       return validatePreviousHash(*block, ledger_state.top_block_info.top_hash)
           and validateHeight(*block, ledger_state.top_block_info.height)
-          and validatePeerSupermajority(*block, ledger_state.ledger_peers);
+          and validatePeerSupermajority(
+                  *block, prefetched, ledger_state.ledger_peers);
     }
 
   }  // namespace validation
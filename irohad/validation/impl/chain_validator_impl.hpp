@@ -9,7 +9,11 @@
 #include "validation/chain_validator.hpp"
 
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
+#include "consensus/consensus_block_cache.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -32,16 +36,68 @@ namespace iroha {
   namespace validation {
     class ChainValidatorImpl : public ChainValidator {
      public:
+      /// Maximum number of blocks fetched and checked ahead of the applied one
+      static constexpr size_t kPrefetchDepth = 8;
+
+      /**
+       * @param supermajority_checker - supermajority checker
+       * @param block_cache - consensus result of the current round. A block
+       * with the same hash is taken from the cache instead of the network
+       * @param log - logger
+       */
       ChainValidatorImpl(std::shared_ptr<consensus::yac::SupermajorityChecker>
                              supermajority_checker,
+                         std::shared_ptr<consensus::ConsensusResultCache>
+                             block_cache,
                          logger::LoggerPtr log);
 
+      /**
+       * Blocks are fetched on a single prefetch thread up to kPrefetchDepth
+       * blocks ahead, so that their stateless validation and the check of
+       * signatory keys against ledger peers overlap with application of the
+       * previous blocks. An error of the block stream is rethrown after the
+       * blocks received before it are applied
+       */
       bool validateAndApply(
           rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
               blocks,
           ametsuchi::MutableStorage &storage) const override;
 
      private:
+      /**
+       * Public keys of ledger peers. Reused for consecutive blocks while the
+       * ledger peers do not change
+       */
+      struct PeerKeys {
+        /// keys in the order of ledger peers
+        std::vector<std::string> ordered;
+        /// the same keys sorted for lookups
+        std::vector<std::string> sorted;
+      };
+
+      /**
+       * Block received from the network along with the check of its signatory
+       * keys made in advance
+       */
+      struct PrefetchedBlock {
+        std::shared_ptr<shared_model::interface::Block> block;
+        /// keys the check was made against, nullptr if it was not made
+        std::shared_ptr<const PeerKeys> checked_keys;
+        bool signed_by_peers;
+      };
+
+      /// Get the keys of given peers, reusing the cached ones if unchanged
+      std::shared_ptr<const PeerKeys> getPeerKeys(
+          const shared_model::interface::types::PeerList &peers) const;
+
+      /// Replace the block with the consensus result if their hashes match
+      std::shared_ptr<shared_model::interface::Block> fromCache(
+          std::shared_ptr<shared_model::interface::Block> block) const;
+
+      /// Verifies whether all signatures of block belong to the given keys
+      bool signedByPeers(const shared_model::interface::Block &block,
+                         const PeerKeys &keys) const;
+
       /// Verifies whether previous hash of block matches top_hash
       bool validatePreviousHash(
           const shared_model::interface::Block &block,
@@ -52,11 +108,18 @@ namespace iroha {
           const shared_model::interface::Block &block,
           const shared_model::interface::types::HeightType &top_height) const;
 
-      /// Verifies whether the block is signed by supermajority of peers
+      /**
+       * Verifies whether the block is signed by supermajority of peers
+       * @param block - block to check
+       * @param prefetched - the block as it was fetched, if available. Its
+       * check of signatory keys is reused when it was made against the same
+       * ledger peers
+       * @param peers - ledger peers
+       */
       bool validatePeerSupermajority(
           const shared_model::interface::Block &block,
-          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
-              &peers) const;
+          const PrefetchedBlock *prefetched,
+          const shared_model::interface::types::PeerList &peers) const;
 
       /**
        * Verifies previous hash and whether the block is signed by supermajority
@@ -64,6 +127,7 @@ namespace iroha {
        */
       bool validateBlock(
           std::shared_ptr<const shared_model::interface::Block> block,
+          const PrefetchedBlock *prefetched,
           const iroha::LedgerState &ledger_state) const;
 
       /**
@@ -72,6 +136,11 @@ namespace iroha {
       std::shared_ptr<consensus::yac::SupermajorityChecker>
           supermajority_checker_;
 
+      std::shared_ptr<consensus::ConsensusResultCache> block_cache_;
+
+      mutable std::mutex peer_keys_mutex_;
+      mutable std::shared_ptr<const PeerKeys> peer_keys_;
+
       logger::LoggerPtr log_;
     };
   }  // namespace validation
@@ -0,0 +1,72 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/signatory_conflicts.hpp"
+
+#include <ciso646>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/call_engine.hpp"
+#include "interfaces/commands/call_model.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    SignatoryWriteSet getSignatoryWriteSet(
+        const shared_model::interface::Transaction &tx) {
+      using namespace shared_model::interface;
+      SignatoryWriteSet write_set;
+      for (const auto &command : tx.commands()) {
+        visit_in_place(
+            command.get(),
+            [&](const CreateAccount &c) {
+              write_set.accounts.insert(c.accountName() + "@" + c.domainId());
+            },
+            [&](const AddSignatory &c) {
+              write_set.accounts.insert(c.accountId());
+            },
+            [&](const RemoveSignatory &c) {
+              write_set.accounts.insert(c.accountId());
+            },
+            [&](const SetQuorum &c) {
+              write_set.accounts.insert(c.accountId());
+            },
+            [&](const CallEngine &) { write_set.any_account = true; },
+            [&](const CallModel &) { write_set.any_account = true; },
+            [](const auto &) {});
+      }
+      return write_set;
+    }
+
+    std::vector<bool> findIndependentSignatureChecks(
+        const shared_model::interface::types::TransactionsCollectionType
+            &txs) {
+      std::vector<bool> independent;
+      independent.reserve(boost::size(txs));
+      SignatoryWriteSet preceding_writes;
+      for (const auto &tx : txs) {
+        independent.push_back(
+            not preceding_writes.any_account
+            and preceding_writes.accounts.count(tx.creatorAccountId()) == 0);
+        if (preceding_writes.any_account) {
+          // nothing can be checked in advance any more
+          continue;
+        }
+        auto write_set = getSignatoryWriteSet(tx);
+        preceding_writes.any_account = write_set.any_account;
+        preceding_writes.accounts.insert(write_set.accounts.begin(),
+                                         write_set.accounts.end());
+      }
+      return independent;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
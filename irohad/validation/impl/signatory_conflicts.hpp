@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SIGNATORY_CONFLICTS_HPP
+#define IROHA_SIGNATORY_CONFLICTS_HPP
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "interfaces/common_objects/range_types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Accounts whose signatories or quorum a transaction may change, as far as
+     * it can be told from its commands without executing them
+     */
+    struct SignatoryWriteSet {
+      std::unordered_set<std::string> accounts;
+      /// the transaction has commands with unknown effect, e.g. a smart
+      /// contract call, and may change any account
+      bool any_account = false;
+    };
+
+    /**
+     * Get the accounts whose signatories or quorum the transaction may change
+     */
+    SignatoryWriteSet getSignatoryWriteSet(
+        const shared_model::interface::Transaction &tx);
+
+    /**
+     * Find the transactions whose signatures can be checked before any of the
+     * transactions is applied, giving the same result as the check made right
+     * before the transaction is applied. This is the case when no preceding
+     * transaction may change signatories or quorum of the creator
+     * @param txs - transactions in the order of application
+     * @return a flag for each transaction
+     */
+    std::vector<bool> findIndependentSignatureChecks(
+        const shared_model::interface::types::TransactionsCollectionType &txs);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_SIGNATORY_CONFLICTS_HPP
@@ -15,6 +15,7 @@
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "logger/logger.hpp"
+#include "validation/impl/signatory_conflicts.hpp"
 
 namespace iroha {
   namespace validation {
@@ -39,6 +40,29 @@ namespace iroha {
           });
     };
 
+    /**
+     * Check signatures of the transactions which do not depend on preceding
+     * transactions of the proposal in a single request to the storage
+     * @param txs to be validated
+     * @param temporary_wsv to check the signatures on
+     * @return number of transactions checked in advance
+     */
+    static size_t prevalidateSignatures(
+        const shared_model::interface::types::TransactionsCollectionType &txs,
+        ametsuchi::TemporaryWsv &temporary_wsv) {
+      auto independent = findIndependentSignatureChecks(txs);
+      std::vector<
+          std::reference_wrapper<const shared_model::interface::Transaction>>
+          independent_txs;
+      for (const auto &tx : txs | boost::adaptors::indexed()) {
+        if (independent.at(tx.index())) {
+          independent_txs.emplace_back(tx.value());
+        }
+      }
+      temporary_wsv.prevalidateSignatures(independent_txs);
+      return independent_txs.size();
+    }
+
     /**
      * Validate all transactions supplied; includes special rules, such as batch
      * validation etc
@@ -126,6 +150,10 @@ namespace iroha {
       log_->info("transactions in proposal: {}",
                  proposal.transactions().size());
 
+      auto prevalidated =
+          prevalidateSignatures(proposal.transactions(), temporaryWsv);
+      log_->debug("signatures checked in advance: {}", prevalidated);
+
       auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
       auto valid_txs =
           validateTransactions(proposal.transactions(),
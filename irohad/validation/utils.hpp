@@ -9,7 +9,6 @@
 #include <string>
 #include <vector>
 
-#include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/any_range.hpp>
 
 #include "interfaces/common_objects/types.hpp"
@@ -40,23 +39,6 @@ namespace iroha {
           });
     }
 
-    /**
-     * Checks if `signatures' is a subset of signatures of `peers'
-     * @param signatures to check
-     * @param peers with signatures
-     * @return true if is a subset or false otherwise
-     */
-    template <typename Peers>
-    inline bool peersSubset(
-        const shared_model::interface::types::SignatureRangeType &signatures,
-        const Peers &peers) {
-      using shared_model::interface::types::PublicKeyHexStringView;
-      return signaturesSubset(
-          signatures, peers | boost::adaptors::transformed([](auto const &p) {
-                        return PublicKeyHexStringView{p->pubkey()};
-                      }));
-    }
-
   }  // namespace validation
 }  // namespace iroha
 
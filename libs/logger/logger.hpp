@@ -9,6 +9,7 @@
 #include "logger/logger_fwd.hpp"
 
 #include <string>
+#include <utility>
 
 #include <fmt/core.h>
 #include <fmt/format.h>
@@ -16,6 +17,28 @@
 // struct, leading to compilation issues
 #undef interface
 
+namespace logger {
+
+  /**
+   * Log argument which is computed only when the message is formatted, that
+   * is when the log level is enabled.
+   */
+  template <typename F>
+  struct LazyArg {
+    F compute;
+  };
+
+  /**
+   * Defer computation of a log argument, e.g.
+   * log.debug("hash {}", logger::lazy([&] { return obj.hash().hex(); }))
+   */
+  template <typename F>
+  LazyArg<F> lazy(F compute) {
+    return LazyArg<F>{std::move(compute)};
+  }
+
+}  // namespace logger
+
 namespace fmt {
   /// Allows to log objects, which have toString() method without calling it,
   /// e.g. log.info("{}", myObject)
@@ -36,6 +59,21 @@ namespace fmt {
       return format_to(ctx.out(), "{}", val.toString());
     }
   };
+
+  /// Computes the deferred argument when the message is formatted
+  template <typename F>
+  struct formatter<logger::LazyArg<F>> {
+    template <typename ParseContext>
+    auto parse(ParseContext &ctx) -> decltype(ctx.begin()) {
+      return ctx.begin();
+    }
+
+    template <typename FormatContext>
+    auto format(const logger::LazyArg<F> &val, FormatContext &ctx)
+        -> decltype(ctx.out()) {
+      return format_to(ctx.out(), "{}", val.compute());
+    }
+  };
 }  // namespace fmt
 
 namespace logger {
@@ -61,40 +99,42 @@ namespace logger {
     virtual ~Logger() = default;
 
     // --- Logging functions ---
+    // The format is taken as a string view and the arguments by reference, so
+    // that a message of a disabled level costs nothing but the level check.
 
     template <typename... Args>
-    void trace(const std::string &format, const Args &... args) const {
+    void trace(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kTrace, format, args...);
     }
 
     template <typename... Args>
-    void debug(const std::string &format, const Args &... args) const {
+    void debug(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kDebug, format, args...);
     }
 
     template <typename... Args>
-    void info(const std::string &format, const Args &... args) const {
+    void info(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kInfo, format, args...);
     }
 
     template <typename... Args>
-    void warn(const std::string &format, const Args &... args) const {
+    void warn(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kWarn, format, args...);
     }
 
     template <typename... Args>
-    void error(const std::string &format, const Args &... args) const {
+    void error(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kError, format, args...);
     }
 
     template <typename... Args>
-    void critical(const std::string &format, const Args &... args) const {
+    void critical(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kCritical, format, args...);
     }
 
     template <typename... Args>
     void log(Level level,
-             const std::string &format,
+             fmt::string_view format,
              const Args &... args) const {
       if (shouldLog(level)) {
         try {
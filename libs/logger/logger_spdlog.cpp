@@ -9,6 +9,7 @@
 #include <ciso646>
 #include <mutex>
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 #include <boost/assert.hpp>
@@ -35,10 +36,38 @@ namespace {
     }
   }
 
-  std::shared_ptr<spdlog::logger> getOrCreateLogger(const std::string tag) {
+  /**
+   * Start the background thread of asynchronous loggers. Only the first
+   * configuration takes effect, since the thread and its queue are shared.
+   */
+  void initAsyncLogging(const logger::AsyncLoggingConfig &config) {
+    static std::once_flag once;
+    std::call_once(once, [&config] {
+      spdlog::init_thread_pool(config.queue_size, 1);
+      spdlog::flush_every(config.flush_interval);
+    });
+  }
+
+  std::shared_ptr<spdlog::logger> createLogger(
+      const std::string &tag, const logger::LoggerConfig &config) {
+    if (not config.async) {
+      return spdlog::stdout_color_mt(tag);
+    }
+    initAsyncLogging(*config.async);
+    switch (config.async->overflow_policy) {
+      case logger::AsyncLoggingConfig::OverflowPolicy::kDrop:
+        return spdlog::stdout_color_mt<spdlog::async_factory_nonblock>(tag);
+      case logger::AsyncLoggingConfig::OverflowPolicy::kBlock:
+      default:
+        return spdlog::stdout_color_mt<spdlog::async_factory>(tag);
+    }
+  }
+
+  std::shared_ptr<spdlog::logger> getOrCreateLogger(
+      const std::string tag, const logger::LoggerConfig &config) {
     std::shared_ptr<spdlog::logger> logger;
     try {
-      logger = spdlog::stdout_color_mt(tag);
+      logger = createLogger(tag, config);
     } catch (const spdlog::spdlog_ex &) {
       logger = spdlog::get(tag);
     }
@@ -50,6 +79,10 @@ namespace {
 
 namespace logger {
 
+  void shutdownAsyncLogging() {
+    spdlog::shutdown();
+  }
+
   LogPatterns getDefaultLogPatterns() {
     static std::atomic_flag is_initialized = ATOMIC_FLAG_INIT;
     static LogPatterns default_patterns;
@@ -89,13 +122,19 @@ namespace logger {
   }
 
   LoggerSpdlog::LoggerSpdlog(std::string tag, ConstLoggerConfigPtr config)
-      : tag_(tag), config_(std::move(config)), logger_(getOrCreateLogger(tag)) {
+      : tag_(tag),
+        config_(std::move(config)),
+        logger_(getOrCreateLogger(tag, *config_)) {
     setupLogger();
   }
 
   void LoggerSpdlog::setupLogger() {
     logger_->set_level(getSpdlogLogLevel(config_->log_level));
     logger_->set_pattern(config_->patterns.getPattern(config_->log_level));
+    if (config_->async) {
+      // do not let errors stay in the queue until the periodic flush
+      logger_->flush_on(spdlog::level::err);
+    }
   }
 
   void LoggerSpdlog::logInternal(Level level, const std::string &s) const {
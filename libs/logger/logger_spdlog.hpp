@@ -8,10 +8,13 @@
 
 #include "logger/logger.hpp"
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
 
+#include <boost/optional.hpp>
+
 namespace spdlog {
   class logger;
 }
@@ -45,10 +48,36 @@ namespace logger {
     std::map<LogLevel, std::string> patterns_;
   };
 
+  /// Parameters of asynchronous logging. They are shared by all loggers.
+  struct AsyncLoggingConfig {
+    /// What to do with a new message when the queue is full
+    enum class OverflowPolicy {
+      /// wait for a free slot in the queue
+      kBlock,
+      /// overwrite the oldest message in the queue
+      kDrop,
+    };
+
+    /// Number of messages the queue can hold
+    size_t queue_size = 8192;
+    OverflowPolicy overflow_policy = OverflowPolicy::kBlock;
+    /// Period of sinks flush by the background thread
+    std::chrono::seconds flush_interval{1};
+  };
+
+  /**
+   * Write out the messages queued by asynchronous loggers and stop their
+   * background thread. Called once on shutdown, when no more messages are
+   * logged.
+   */
+  void shutdownAsyncLogging();
+
   // TODO mboldyrev 29.12.2018 IR-188 Add sink options (console, file, syslog)
   struct LoggerConfig {
     LogLevel log_level;
     LogPatterns patterns;
+    /// Write messages from a background thread. Synchronous if not set.
+    boost::optional<AsyncLoggingConfig> async = boost::none;
   };
 
   class LoggerSpdlog : public Logger {
@@ -22,6 +22,13 @@ namespace shared_model {
       explicit Block(const TransportType &ref);
       explicit Block(TransportType &&ref);
 
+      /**
+       * Create block of the transport allocated on the arena
+       * @param arena - arena which is destroyed with the block
+       * @param ref - transport owned by the arena
+       */
+      Block(std::unique_ptr<google::protobuf::Arena> arena, TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
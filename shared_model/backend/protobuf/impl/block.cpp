@@ -10,6 +10,7 @@
 #include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
 #include "common/byteutils.hpp"
+#include "utils/reference_holder.hpp"
 
 namespace shared_model {
   namespace proto {
@@ -17,27 +18,29 @@ namespace shared_model {
     struct Block::Impl {
       explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
       explicit Impl(const TransportType &ref) : proto_(ref) {}
+      Impl(std::unique_ptr<google::protobuf::Arena> arena, TransportType &ref)
+          : arena_(std::move(arena)), proto_(ref) {}
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
-      TransportType proto_;
-      iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
+      // declared before the transport, so that it outlives the transport
+      std::unique_ptr<google::protobuf::Arena> arena_;
+      detail::ReferenceHolder<TransportType> proto_;
+      iroha::protocol::Block_v1::Payload &payload_{*proto_->mutable_payload()};
 
-      std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            payload_.mutable_transactions()->begin(),
-            payload_.mutable_transactions()->end());
-      }()};
+      std::vector<proto::Transaction> transactions_{
+          proto::Transaction::makeTransactions(
+              *payload_.mutable_transactions())};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
 
       interface::types::HashType prev_hash_{[this] {
         return interface::types::HashType(
-            crypto::Hash::fromHexString(proto_.payload().prev_block_hash()));
+            crypto::Hash::fromHexString(proto_->payload().prev_block_hash()));
       }()};
 
       SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_.mutable_signatures()
+        auto signatures = *proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
@@ -71,6 +74,11 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(std::unique_ptr<google::protobuf::Arena> arena,
+                 TransportType &ref) {
+      impl_ = std::make_unique<Block::Impl>(std::move(arena), ref);
+    }
+
     interface::types::TransactionsCollectionType Block::transactions() const {
       return impl_->transactions_;
     }
@@ -104,20 +112,20 @@ namespace shared_model {
         return false;
       }
 
-      auto sig = impl_->proto_.add_signatures();
+      auto sig = impl_->proto_->add_signatures();
       std::string_view const &signed_string{signed_blob};
       sig->set_signature(signed_string.data(), signed_string.size());
       std::string_view const &public_key_string{public_key};
       sig->set_public_key(public_key_string.data(), public_key_string.size());
 
       impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_.mutable_signatures()
+        auto signatures = *impl_->proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
                                                   signatures.end());
       }();
-      impl_->blob_ = makeBlob(impl_->proto_);
+      impl_->blob_ = makeBlob(*impl_->proto_);
 
       return true;
     }
@@ -144,11 +152,11 @@ namespace shared_model {
     }
 
     const iroha::protocol::Block_v1 &Block::getTransport() const {
-      return impl_->proto_;
+      return *impl_->proto_;
     }
 
     Block::ModelType *Block::clone() const {
-      return new Block(impl_->proto_);
+      return new Block(*impl_->proto_);
     }
 
     Block::~Block() = default;
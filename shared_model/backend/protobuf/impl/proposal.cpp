@@ -7,6 +7,7 @@
 
 #include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
+#include "utils/reference_holder.hpp"
 
 namespace shared_model {
   namespace proto {
@@ -17,15 +18,19 @@ namespace shared_model {
 
       explicit Impl(const TransportType &ref) : proto_(ref) {}
 
-      TransportType proto_;
+      Impl(std::unique_ptr<google::protobuf::Arena> arena, TransportType &ref)
+          : arena_(std::move(arena)), proto_(ref) {}
 
-      const std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            proto_.mutable_transactions()->begin(),
-            proto_.mutable_transactions()->end());
-      }()};
+      // declared before the transport, so that it outlives the transport
+      std::unique_ptr<google::protobuf::Arena> arena_;
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      detail::ReferenceHolder<TransportType> proto_;
+
+      const std::vector<proto::Transaction> transactions_{
+          proto::Transaction::makeTransactions(
+              *proto_->mutable_transactions())};
+
+      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
 
       const interface::types::HashType hash_{
           [this] { return crypto::DefaultHashProvider::makeHash(blob_); }()};
@@ -41,16 +46,21 @@ namespace shared_model {
       impl_ = std::make_unique<Proposal::Impl>(std::move(ref));
     }
 
+    Proposal::Proposal(std::unique_ptr<google::protobuf::Arena> arena,
+                       TransportType &ref) {
+      impl_ = std::make_unique<Proposal::Impl>(std::move(arena), ref);
+    }
+
     TransactionsCollectionType Proposal::transactions() const {
       return impl_->transactions_;
     }
 
     TimestampType Proposal::createdTime() const {
-      return impl_->proto_.created_time();
+      return impl_->proto_->created_time();
     }
 
     HeightType Proposal::height() const {
-      return impl_->proto_.height();
+      return impl_->proto_->height();
     }
 
     const interface::types::BlobType &Proposal::blob() const {
@@ -58,7 +68,7 @@ namespace shared_model {
     }
 
     const Proposal::TransportType &Proposal::getTransport() const {
-      return impl_->proto_;
+      return *impl_->proto_;
     }
 
     const interface::types::HashType &Proposal::hash() const {
@@ -9,6 +9,7 @@
 
 #include <boost/assert.hpp>
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/util.hpp"
 
 using namespace shared_model;
 using namespace shared_model::proto;
@@ -29,7 +30,16 @@ ProtoBlockFactory::unsafeCreateBlock(
     interface::types::TimestampType created_time,
     const interface::types::TransactionsCollectionType &txs,
     const interface::types::HashCollectionType &rejected_hashes) {
-  iroha::protocol::Block_v1 block;
+  size_t serialized_size = 0;
+  for (const auto &tx : txs) {
+    serialized_size += tx.blob().size();
+  }
+  // the container is used by the validator, and is freed with the arena
+  auto arena = makeArena(serialized_size);
+  auto &proto_block_container =
+      *google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+          arena.get());
+  auto &block = *proto_block_container.mutable_block_v1();
   auto *block_payload = block.mutable_payload();
   block_payload->set_height(height);
   block_payload->set_prev_block_hash(prev_hash.hex());
@@ -51,13 +61,10 @@ ProtoBlockFactory::unsafeCreateBlock(
                   (*next_hash) = hash.hex();
                 });
 
-  iroha::protocol::Block proto_block_container;
-  proto_block_container.set_allocated_block_v1(&block);
   assert(not proto_validator_->validate(proto_block_container));
-  proto_block_container.release_block_v1();
 
   auto model_proto_block =
-      std::make_unique<shared_model::proto::Block>(std::move(block));
+      std::make_unique<shared_model::proto::Block>(std::move(arena), block);
   assert(not interface_validator_->validate(*model_proto_block));
 
   return model_proto_block;
@@ -78,3 +85,20 @@ ProtoBlockFactory::createBlock(iroha::protocol::Block block) {
 
   return iroha::expected::makeValue(std::move(proto_block));
 }
+
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+ProtoBlockFactory::createBlock(std::unique_ptr<google::protobuf::Arena> arena,
+                               iroha::protocol::Block &block) {
+  if (auto error = proto_validator_->validate(block)) {
+    return iroha::expected::makeError(error->toString());
+  }
+
+  std::unique_ptr<shared_model::interface::Block> proto_block =
+      std::make_unique<Block>(std::move(arena), *block.mutable_block_v1());
+  if (auto error = interface_validator_->validate(*proto_block)) {
+    return iroha::expected::makeError(error->toString());
+  }
+
+  return iroha::expected::makeValue(std::move(proto_block));
+}
@@ -20,14 +20,17 @@ namespace {
    * a query response
    * @param response_creator - that lambda
    * @param query_hash - hash of query, for which response is created
+   * @param height - height of the ledger state the response is made from
    * @return unique_ptr to created query response
    */
   template <typename QueryResponseCreatorLambda>
   std::unique_ptr<shared_model::interface::QueryResponse> createQueryResponse(
       QueryResponseCreatorLambda response_creator,
-      const shared_model::crypto::Hash &query_hash) {
+      const shared_model::crypto::Hash &query_hash,
+      shared_model::interface::types::HeightType height) {
     iroha::protocol::QueryResponse protocol_query_response;
     protocol_query_response.set_query_hash(query_hash.hex());
+    protocol_query_response.set_height(height);
 
     response_creator(protocol_query_response);
 
@@ -62,7 +65,8 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountAssetResponse(
                            shared_model::interface::Amount>> assets,
     size_t total_assets_number,
     std::optional<shared_model::interface::types::AssetIdType> next_asset_id,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [assets = std::move(assets),
        total_assets_number,
@@ -81,7 +85,8 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountAssetResponse(
           protocol_specific_response->set_next_asset_id(*next_asset_id);
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
@@ -90,7 +95,8 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountDetailResponse(
     size_t total_number,
     std::optional<std::reference_wrapper<
         const shared_model::interface::AccountDetailRecordId>> next_record_id,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [&account_detail, total_number, &next_record_id](
           iroha::protocol::QueryResponse &protocol_query_response) {
@@ -105,7 +111,8 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountDetailResponse(
           protocol_next_record_id->set_key(next_record_id->get().key());
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
@@ -115,7 +122,8 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountResponse(
     shared_model::interface::types::QuorumType quorum,
     const shared_model::interface::types::JsonType jsonData,
     std::vector<shared_model::interface::types::RoleIdType> roles,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [account_id = std::move(account_id),
        domain_id = std::move(domain_id),
@@ -134,13 +142,15 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountResponse(
           protocol_specific_response->add_account_roles(std::move(role));
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createBlockResponse(
     std::unique_ptr<shared_model::interface::Block> block,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [block = std::move(block)](
           iroha::protocol::QueryResponse &protocol_query_response) {
@@ -150,7 +160,8 @@ shared_model::proto::ProtoQueryResponseFactory::createBlockResponse(
             static_cast<shared_model::proto::Block *>(block.get())
                 ->getTransport();
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
@@ -158,7 +169,8 @@ shared_model::proto::ProtoQueryResponseFactory::createErrorQueryResponse(
     ErrorQueryType error_type,
     interface::ErrorQueryResponse::ErrorMessageType error_msg,
     interface::ErrorQueryResponse::ErrorCodeType error_code,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [error_type, error_msg = std::move(error_msg), error_code](
           iroha::protocol::QueryResponse &protocol_query_response) mutable {
@@ -198,13 +210,15 @@ shared_model::proto::ProtoQueryResponseFactory::createErrorQueryResponse(
         protocol_specific_response->set_message(std::move(error_msg));
         protocol_specific_response->set_error_code(error_code);
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createSignatoriesResponse(
     std::vector<std::string> signatories,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [signatories = std::move(signatories)](
           iroha::protocol::QueryResponse &protocol_query_response) {
@@ -214,14 +228,16 @@ shared_model::proto::ProtoQueryResponseFactory::createSignatoriesResponse(
           protocol_specific_response->add_keys(key);
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createTransactionsResponse(
     std::vector<std::unique_ptr<shared_model::interface::Transaction>>
         transactions,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [transactions = std::move(transactions)](
           iroha::protocol::QueryResponse &protocol_query_response) {
@@ -233,7 +249,8 @@ shared_model::proto::ProtoQueryResponseFactory::createTransactionsResponse(
                   ->getTransport();
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
@@ -242,7 +259,8 @@ shared_model::proto::ProtoQueryResponseFactory::createTransactionsPageResponse(
         transactions,
     std::optional<std::reference_wrapper<const crypto::Hash>> next_tx_hash,
     interface::types::TransactionsNumberType all_transactions_size,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [transactions = std::move(transactions),
        &next_tx_hash,
@@ -262,7 +280,8 @@ shared_model::proto::ProtoQueryResponseFactory::createTransactionsPageResponse(
         protocol_specific_response->set_all_transactions_size(
             all_transactions_size);
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse> shared_model::proto::
@@ -272,7 +291,8 @@ std::unique_ptr<shared_model::interface::QueryResponse> shared_model::proto::
         interface::types::TransactionsNumberType all_transactions_size,
         std::optional<interface::PendingTransactionsPageResponse::BatchInfo>
             next_batch_info,
-        const crypto::Hash &query_hash) const {
+        const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [transactions = std::move(transactions),
        &all_transactions_size,
@@ -296,7 +316,8 @@ std::unique_ptr<shared_model::interface::QueryResponse> shared_model::proto::
           next_batch_info_message->set_batch_size(next_batch_info->batch_size);
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
@@ -304,7 +325,8 @@ shared_model::proto::ProtoQueryResponseFactory::createAssetResponse(
     const interface::types::AssetIdType asset_id,
     const interface::types::DomainIdType domain_id,
     const interface::types::PrecisionType precision,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [asset_id = std::move(asset_id),
        domain_id = std::move(domain_id),
@@ -316,13 +338,15 @@ shared_model::proto::ProtoQueryResponseFactory::createAssetResponse(
         asset->set_domain_id(std::move(domain_id));
         asset->set_precision(precision);
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createRolesResponse(
     std::vector<shared_model::interface::types::RoleIdType> roles,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [roles = std::move(roles)](
           iroha::protocol::QueryResponse &protocol_query_response) mutable {
@@ -332,13 +356,15 @@ shared_model::proto::ProtoQueryResponseFactory::createRolesResponse(
           protocol_specific_response->add_roles(std::move(role));
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createRolePermissionsResponse(
     shared_model::interface::RolePermissionSet role_permissions,
-    const crypto::Hash &query_hash) const {
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [role_permissions](
           iroha::protocol::QueryResponse &protocol_query_response) {
@@ -352,12 +378,15 @@ shared_model::proto::ProtoQueryResponseFactory::createRolePermissionsResponse(
           }
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createPeersResponse(
-    interface::types::PeerList peers, const crypto::Hash &query_hash) const {
+    interface::types::PeerList peers,
+    const crypto::Hash &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [peers](iroha::protocol::QueryResponse &protocol_query_response) {
         auto *protocol_specific_response =
@@ -368,14 +397,16 @@ shared_model::proto::ProtoQueryResponseFactory::createPeersResponse(
           proto_peer->set_peer_key(peer->pubkey());
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createEngineReceiptsResponse(
     std::vector<std::unique_ptr<shared_model::interface::EngineReceipt>> const
         &engine_receipts,
-    crypto::Hash const &query_hash) const {
+    crypto::Hash const &query_hash,
+    interface::types::HeightType height) const {
   return createQueryResponse(
       [&](iroha::protocol::QueryResponse &protocol_query_response) {
         auto *protocol_specific_response =
@@ -414,7 +445,8 @@ shared_model::proto::ProtoQueryResponseFactory::createEngineReceiptsResponse(
           }
         }
       },
-      query_hash);
+      query_hash,
+      height);
 }
 
 std::unique_ptr<shared_model::interface::BlockQueryResponse>
@@ -38,7 +38,8 @@ namespace shared_model {
       interface::types::BlobType reduced_payload_blob_{
           [this] { return makeBlob(reduced_payload_); }()};
 
-      interface::types::HashType reduced_hash_{makeHash(reduced_payload_blob_)};
+      // hashes are set by Transaction::hashPayloads
+      interface::types::HashType reduced_hash_;
 
       std::vector<proto::Command> commands_{
           reduced_payload_.mutable_commands()->begin(),
@@ -62,19 +63,59 @@ namespace shared_model {
                                                   signatures.end());
       }()};
 
-      interface::types::HashType hash_{makeHash(payload_blob_)};
+      interface::types::HashType hash_;
     };
 
     Transaction::Transaction(const TransportType &transaction) {
       impl_ = std::make_unique<Transaction::Impl>(transaction);
+      hashPayloads({this});
     }
 
     Transaction::Transaction(TransportType &&transaction) {
       impl_ = std::make_unique<Transaction::Impl>(std::move(transaction));
+      hashPayloads({this});
     }
 
     Transaction::Transaction(TransportType &transaction) {
       impl_ = std::make_unique<Transaction::Impl>(transaction);
+      hashPayloads({this});
+    }
+
+    Transaction::Transaction(TransportType &transaction, UnhashedTag) {
+      impl_ = std::make_unique<Transaction::Impl>(transaction);
+    }
+
+    std::vector<Transaction> Transaction::makeTransactions(
+        google::protobuf::RepeatedPtrField<TransportType> &transports) {
+      std::vector<Transaction> transactions;
+      transactions.reserve(transports.size());
+      for (auto &transport : transports) {
+        transactions.push_back(Transaction(transport, UnhashedTag{}));
+      }
+
+      std::vector<Transaction *> pointers;
+      pointers.reserve(transactions.size());
+      for (auto &transaction : transactions) {
+        pointers.push_back(&transaction);
+      }
+      hashPayloads(pointers);
+      return transactions;
+    }
+
+    void Transaction::hashPayloads(
+        const std::vector<Transaction *> &transactions) {
+      std::vector<const interface::types::BlobType *> payloads;
+      payloads.reserve(transactions.size() * 2);
+      for (auto transaction : transactions) {
+        payloads.push_back(&transaction->impl_->reduced_payload_blob_);
+        payloads.push_back(&transaction->impl_->payload_blob_);
+      }
+
+      auto hashes = makeHashes(payloads);
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        transactions[i]->impl_->reduced_hash_ = std::move(hashes[2 * i]);
+        transactions[i]->impl_->hash_ = std::move(hashes[2 * i + 1]);
+      }
     }
 
     // TODO [IR-1866] Akvinikym 13.11.18: remove the copy ctor and fix fallen
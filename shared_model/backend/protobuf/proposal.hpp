@@ -22,6 +22,14 @@ namespace shared_model {
       explicit Proposal(const TransportType &ref);
       explicit Proposal(TransportType &&ref);
 
+      /**
+       * Create proposal of the transport allocated on the arena
+       * @param arena - arena which is destroyed with the proposal
+       * @param ref - transport owned by the arena
+       */
+      Proposal(std::unique_ptr<google::protobuf::Arena> arena,
+               TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
@@ -43,6 +43,18 @@ namespace shared_model {
       iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
       createBlock(iroha::protocol::Block block);
 
+      /**
+       * Create block variant of the proto block allocated on the arena
+       *
+       * @param arena - arena which is destroyed with the created block
+       * @param block - proto block owned by the arena
+       * @return Pointer to block.
+       *         Error if block is invalid
+       */
+      iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
+      createBlock(std::unique_ptr<google::protobuf::Arena> arena,
+                  iroha::protocol::Block &block);
+
      private:
       std::unique_ptr<shared_model::validation::AbstractValidator<
           shared_model::interface::Block>>
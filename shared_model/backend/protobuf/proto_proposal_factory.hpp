@@ -12,6 +12,7 @@
 
 #include "backend/protobuf/proposal.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "backend/protobuf/util.hpp"
 #include "proposal.pb.h"
 
 namespace shared_model {
@@ -32,8 +33,7 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           TransactionsCollectionType transactions) override {
-        return createProposal(
-            createProtoProposal(height, created_time, transactions));
+        return validate(makeProposal(height, created_time, transactions));
       }
 
       // TODO mboldyrev 13.02.2019 IR-323
@@ -42,8 +42,7 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) override {
-        return std::make_unique<Proposal>(
-            createProtoProposal(height, created_time, transactions));
+        return makeProposal(height, created_time, transactions);
       }
 
       /**
@@ -55,14 +54,27 @@ namespace shared_model {
       }
 
      private:
-      iroha::protocol::Proposal createProtoProposal(
+      /**
+       * Make proposal, messages of which are allocated on an arena sized for
+       * the transactions, so that they are freed at once with the proposal
+       */
+      std::unique_ptr<Proposal> makeProposal(
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) {
-        iroha::protocol::Proposal proposal;
+        size_t serialized_size = 0;
+        int transactions_number = 0;
+        for (const auto &tx : transactions) {
+          serialized_size += tx.blob().size();
+          ++transactions_number;
+        }
+        auto arena = makeArena(serialized_size);
+        auto &proposal = *google::protobuf::Arena::CreateMessage<
+            iroha::protocol::Proposal>(arena.get());
 
         proposal.set_height(height);
         proposal.set_created_time(created_time);
+        proposal.mutable_transactions()->Reserve(transactions_number);
 
         for (const auto &tx : transactions) {
           *proposal.add_transactions() =
@@ -70,7 +82,7 @@ namespace shared_model {
                   .getTransport();
         }
 
-        return proposal;
+        return std::make_unique<Proposal>(std::move(arena), proposal);
       }
 
       FactoryResult<std::unique_ptr<interface::Proposal>> validate(
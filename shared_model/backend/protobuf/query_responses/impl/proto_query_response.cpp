@@ -102,6 +102,10 @@ namespace shared_model::proto {
     return impl_->hash_;
   }
 
+  interface::types::HeightType QueryResponse::height() const {
+    return impl_->proto_.height();
+  }
+
   const QueryResponse::TransportType &QueryResponse::getTransport() const {
     return impl_->proto_;
   }
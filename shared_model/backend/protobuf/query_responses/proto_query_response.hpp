@@ -24,6 +24,8 @@ namespace shared_model {
 
       const interface::types::HashType &queryHash() const override;
 
+      interface::types::HeightType height() const override;
+
       const TransportType &getTransport() const;
 
      private:
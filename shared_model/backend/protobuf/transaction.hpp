@@ -25,6 +25,16 @@ namespace shared_model {
 
       Transaction(Transaction &&o) noexcept;
 
+      /**
+       * Create transactions referencing the transports, e.g. of a proposal.
+       * Payloads of all transactions are hashed at once, which is faster
+       * than hashing them in each constructor.
+       * @param transports - transports of the transactions
+       * @return transactions in the order of the transports
+       */
+      static std::vector<Transaction> makeTransactions(
+          google::protobuf::RepeatedPtrField<TransportType> &transports);
+
       ~Transaction() override;
 
       const interface::types::AccountIdType &creatorAccountId() const override;
@@ -62,6 +72,14 @@ namespace shared_model {
       Transaction::ModelType *clone() const override;
 
      private:
+      /// selects the constructor which leaves the hashes unset
+      struct UnhashedTag {};
+
+      Transaction(TransportType &transaction, UnhashedTag);
+
+      /// Set the hashes of the payloads of the transactions at once
+      static void hashPayloads(const std::vector<Transaction *> &transactions);
+
       struct Impl;
       std::unique_ptr<Impl> impl_;
     };
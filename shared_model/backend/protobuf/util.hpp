@@ -6,7 +6,10 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 #define IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/message.h>
+#include <algorithm>
+#include <memory>
 #include <vector>
 #include "cryptography/blob.hpp"
 
@@ -21,6 +24,25 @@ namespace shared_model {
       return crypto::Blob(std::move(data));
     }
 
+    /**
+     * Make arena for the messages of a block or a proposal, so that they are
+     * allocated with a few large blocks and freed at once with the arena
+     * @param serialized_size - expected serialized size of the messages, the
+     * first block of the arena fits them
+     */
+    inline std::unique_ptr<google::protobuf::Arena> makeArena(
+        size_t serialized_size) {
+      // parsed messages take about twice as much memory as serialized ones
+      constexpr size_t kSizeFactor = 2;
+      constexpr size_t kMinBlockSize = 1024;
+      google::protobuf::ArenaOptions options;
+      options.start_block_size =
+          std::max(serialized_size * kSizeFactor, kMinBlockSize);
+      options.max_block_size =
+          std::max(options.start_block_size, options.max_block_size);
+      return std::make_unique<google::protobuf::Arena>(options);
+    }
+
   }  // namespace proto
 }  // namespace shared_model
 
@@ -6,6 +6,7 @@
 #ifndef IROHA_SHARED_MODEL_BLOB_HPP
 #define IROHA_SHARED_MODEL_BLOB_HPP
 
+#include <atomic>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -22,7 +23,8 @@ namespace shared_model {
 
     /**
      * Blob class present user-friendly blob for working with low-level
-     * binary stuff. Its length is not fixed in compile time.
+     * binary stuff. Its length is not fixed in compile time. The hex
+     * representation is made on the first call of hex().
      */
     class Blob : public interface::ModelPrimitive<Blob>,
                  public Cloneable<Blob> {
@@ -46,6 +48,16 @@ namespace shared_model {
 
       explicit Blob(Bytes &&blob) noexcept;
 
+      Blob(const Blob &other);
+
+      Blob(Blob &&other) noexcept;
+
+      Blob &operator=(const Blob &other);
+
+      Blob &operator=(Blob &&other) noexcept;
+
+      ~Blob() override;
+
       /**
        * Creates new Blob object from provided hex string
        * @param hex - string in hex format to create Blob from
@@ -82,7 +94,8 @@ namespace shared_model {
 
      private:
       Bytes blob_;
-      std::string hex_;
+      /// hex representation, stored by the first call of hex()
+      mutable std::atomic<const std::string *> hex_{nullptr};
     };
 
   }  // namespace crypto
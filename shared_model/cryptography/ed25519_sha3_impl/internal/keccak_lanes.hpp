@@ -0,0 +1,200 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_KECCAK_LANES_HPP
+#define IROHA_KECCAK_LANES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+/**
+ * Keccak of several inputs in the lanes of SIMD registers. The templates are
+ * instantiated only in the translation units which are compiled for the
+ * corresponding instruction set, and the CPU support is checked at runtime
+ * before the functions are called.
+ */
+namespace iroha {
+  namespace keccak {
+
+    /// number of input bytes absorbed by one permutation of SHA3-256
+    constexpr size_t kSha3_256Rate = 136;
+
+    /**
+     * SHA3-256 of up to four inputs in the lanes of AVX2 registers
+     * @param outputs - 32-byte output of each input
+     * @param inputs - inputs to hash
+     * @param in_sizes - size of each input
+     * @param count - number of inputs, at most four
+     */
+    void sha3_256_x4(uint8_t *const *outputs,
+                     const uint8_t *const *inputs,
+                     const size_t *in_sizes,
+                     size_t count);
+
+    /// SHA3-256 of up to eight inputs in the lanes of AVX-512 registers
+    /// @see sha3_256_x4
+    void sha3_256_x8(uint8_t *const *outputs,
+                     const uint8_t *const *inputs,
+                     const size_t *in_sizes,
+                     size_t count);
+
+    constexpr uint64_t kRoundConstants[24] = {
+        0x0000000000000001, 0x0000000000008082, 0x800000000000808a,
+        0x8000000080008000, 0x000000000000808b, 0x0000000080000001,
+        0x8000000080008081, 0x8000000000008009, 0x000000000000008a,
+        0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+        0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+        0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+        0x000000000000800a, 0x800000008000000a, 0x8000000080008081,
+        0x8000000000008080, 0x0000000080000001, 0x8000000080008008};
+
+    /// rotation offsets of the rho step of the lane x + 5 * y
+    constexpr int kRhoOffsets[25] = {0,  1,  62, 28, 27, 36, 44, 6,  55,
+                                     20, 3,  10, 43, 25, 39, 41, 45, 15,
+                                     21, 8,  18, 2,  61, 56, 14};
+
+    /// @return position of the lane x + 5 * y after the pi step
+    constexpr size_t piPosition(size_t lane) {
+      return lane / 5 + 5 * ((2 * (lane % 5) + 3 * (lane / 5)) % 5);
+    }
+
+    template <typename Ops, int kBits>
+    inline typename Ops::Vector rotate(typename Ops::Vector v) {
+      if constexpr (kBits == 0) {
+        return v;
+      } else {
+        return Ops::template rotate<kBits>(v);
+      }
+    }
+
+    // steps of the round are unrolled with index sequences, so that lane
+    // indexes and rotation offsets are constants
+
+    template <typename Ops, size_t... X>
+    inline void theta(typename Ops::Vector *a, std::index_sequence<X...>) {
+      typename Ops::Vector c[5], d[5];
+      ((c[X] = Ops::bitXor(Ops::bitXor(Ops::bitXor(a[X], a[X + 5]),
+                                       Ops::bitXor(a[X + 10], a[X + 15])),
+                           a[X + 20])),
+       ...);
+      ((d[X] = Ops::bitXor(c[(X + 4) % 5], rotate<Ops, 1>(c[(X + 1) % 5]))),
+       ...);
+      ((a[X] = Ops::bitXor(a[X], d[X]),
+        a[X + 5] = Ops::bitXor(a[X + 5], d[X]),
+        a[X + 10] = Ops::bitXor(a[X + 10], d[X]),
+        a[X + 15] = Ops::bitXor(a[X + 15], d[X]),
+        a[X + 20] = Ops::bitXor(a[X + 20], d[X])),
+       ...);
+    }
+
+    template <typename Ops, size_t... I>
+    inline void rhoPi(const typename Ops::Vector *a,
+                      typename Ops::Vector *b,
+                      std::index_sequence<I...>) {
+      ((b[piPosition(I)] = rotate<Ops, kRhoOffsets[I]>(a[I])), ...);
+    }
+
+    template <typename Ops, size_t... I>
+    inline void chi(const typename Ops::Vector *b,
+                    typename Ops::Vector *a,
+                    std::index_sequence<I...>) {
+      ((a[I] = Ops::bitXor(b[I],
+                           Ops::andNot(b[I - I % 5 + (I + 1) % 5],
+                                       b[I - I % 5 + (I + 2) % 5]))),
+       ...);
+    }
+
+    /**
+     * Keccak-f[1600] permutation of the states in all lanes
+     * @tparam Ops - operations on a vector of 64-bit words of the lanes
+     * @param a - state of 25 vectors
+     */
+    template <typename Ops>
+    inline void permute(typename Ops::Vector *a) {
+      typename Ops::Vector b[25];
+      for (auto round_constant : kRoundConstants) {
+        theta<Ops>(a, std::make_index_sequence<5>{});
+        rhoPi<Ops>(a, b, std::make_index_sequence<25>{});
+        chi<Ops>(b, a, std::make_index_sequence<25>{});
+        a[0] = Ops::bitXor(a[0], Ops::broadcast(round_constant));
+      }
+    }
+
+    /**
+     * SHA3-256 of up to Ops::kLanes inputs. Each input is absorbed in its
+     * own lane, and its digest is taken after the permutation of its last
+     * block, so inputs of different sizes may share the registers. Words are
+     * read in the little-endian order of the supported CPUs.
+     * @see sha3_256_x4
+     */
+    template <typename Ops>
+    inline void sha3_256(uint8_t *const *outputs,
+                         const uint8_t *const *inputs,
+                         const size_t *in_sizes,
+                         size_t count) {
+      constexpr size_t kLanes = Ops::kLanes;
+      constexpr size_t kRateWords = kSha3_256Rate / 8;
+      constexpr size_t kDigestWords = 4;
+
+      // the last block of each input is copied with the padding
+      uint8_t last_blocks[kLanes][kSha3_256Rate] = {};
+      size_t blocks[kLanes] = {};
+      size_t max_blocks = 0;
+      for (size_t i = 0; i < count; ++i) {
+        auto tail = in_sizes[i] % kSha3_256Rate;
+        if (tail != 0) {
+          std::memcpy(last_blocks[i], inputs[i] + in_sizes[i] - tail, tail);
+        }
+        last_blocks[i][tail] ^= 0x06;
+        last_blocks[i][kSha3_256Rate - 1] ^= 0x80;
+        blocks[i] = in_sizes[i] / kSha3_256Rate + 1;
+        if (blocks[i] > max_blocks) {
+          max_blocks = blocks[i];
+        }
+      }
+
+      typename Ops::Vector state[25];
+      for (auto &lane : state) {
+        lane = Ops::zero();
+      }
+      uint64_t words[kLanes];
+      for (size_t block = 0; block < max_blocks; ++block) {
+        const uint8_t *data[kLanes] = {};
+        for (size_t i = 0; i < count; ++i) {
+          if (block + 1 < blocks[i]) {
+            data[i] = inputs[i] + block * kSha3_256Rate;
+          } else if (block + 1 == blocks[i]) {
+            data[i] = last_blocks[i];
+          }
+        }
+        for (size_t w = 0; w < kRateWords; ++w) {
+          for (size_t i = 0; i < kLanes; ++i) {
+            words[i] = 0;
+            if (data[i] != nullptr) {
+              std::memcpy(&words[i], data[i] + w * 8, 8);
+            }
+          }
+          state[w] = Ops::bitXor(state[w], Ops::load(words));
+        }
+
+        permute<Ops>(state);
+
+        for (size_t w = 0; w < kDigestWords; ++w) {
+          Ops::store(words, state[w]);
+          for (size_t i = 0; i < count; ++i) {
+            if (block + 1 == blocks[i]) {
+              std::memcpy(outputs[i] + w * 8, &words[i], 8);
+            }
+          }
+        }
+      }
+    }
+
+  }  // namespace keccak
+}  // namespace iroha
+
+#endif  // IROHA_KECCAK_LANES_HPP
@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// compiled with AVX2 enabled, so only the lanes header is included to keep
+// inline functions of other headers free of AVX2 instructions
+
+#include "cryptography/ed25519_sha3_impl/internal/keccak_lanes.hpp"
+
+#include <immintrin.h>
+
+namespace {
+  struct Avx2Ops {
+    using Vector = __m256i;
+    static constexpr size_t kLanes = 4;
+
+    static Vector zero() {
+      return _mm256_setzero_si256();
+    }
+
+    static Vector load(const uint64_t *words) {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words));
+    }
+
+    static void store(uint64_t *words, Vector v) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(words), v);
+    }
+
+    static Vector broadcast(uint64_t word) {
+      return _mm256_set1_epi64x(static_cast<long long>(word));
+    }
+
+    static Vector bitXor(Vector a, Vector b) {
+      return _mm256_xor_si256(a, b);
+    }
+
+    /// @return ~a & b
+    static Vector andNot(Vector a, Vector b) {
+      return _mm256_andnot_si256(a, b);
+    }
+
+    template <int kBits>
+    static Vector rotate(Vector a) {
+      return _mm256_or_si256(_mm256_slli_epi64(a, kBits),
+                             _mm256_srli_epi64(a, 64 - kBits));
+    }
+  };
+}  // namespace
+
+namespace iroha {
+  namespace keccak {
+
+    void sha3_256_x4(uint8_t *const *outputs,
+                     const uint8_t *const *inputs,
+                     const size_t *in_sizes,
+                     size_t count) {
+      sha3_256<Avx2Ops>(outputs, inputs, in_sizes, count);
+    }
+
+  }  // namespace keccak
+}  // namespace iroha
@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// compiled with AVX-512 enabled, so only the lanes header is included to keep
+// inline functions of other headers free of AVX-512 instructions
+
+#include "cryptography/ed25519_sha3_impl/internal/keccak_lanes.hpp"
+
+#include <immintrin.h>
+
+namespace {
+  struct Avx512Ops {
+    using Vector = __m512i;
+    static constexpr size_t kLanes = 8;
+    /// the zero-masking forms of the intrinsics are used with all lanes
+    /// selected, since the unmasked ones of GCC pass an undefined vector
+    /// through, which it then reports as maybe uninitialized
+    static constexpr __mmask8 kAllLanes = 0xFF;
+
+    static Vector zero() {
+      return _mm512_setzero_si512();
+    }
+
+    static Vector load(const uint64_t *words) {
+      return _mm512_loadu_si512(words);
+    }
+
+    static void store(uint64_t *words, Vector v) {
+      _mm512_storeu_si512(words, v);
+    }
+
+    static Vector broadcast(uint64_t word) {
+      return _mm512_set1_epi64(static_cast<long long>(word));
+    }
+
+    static Vector bitXor(Vector a, Vector b) {
+      return _mm512_xor_si512(a, b);
+    }
+
+    /// @return ~a & b
+    static Vector andNot(Vector a, Vector b) {
+      return _mm512_maskz_andnot_epi64(kAllLanes, a, b);
+    }
+
+    template <int kBits>
+    static Vector rotate(Vector a) {
+      return _mm512_maskz_rol_epi64(kAllLanes, a, kBits);
+    }
+  };
+}  // namespace
+
+namespace iroha {
+  namespace keccak {
+
+    void sha3_256_x8(uint8_t *const *outputs,
+                     const uint8_t *const *inputs,
+                     const size_t *in_sizes,
+                     size_t count) {
+      sha3_256<Avx512Ops>(outputs, inputs, in_sizes, count);
+    }
+
+  }  // namespace keccak
+}  // namespace iroha
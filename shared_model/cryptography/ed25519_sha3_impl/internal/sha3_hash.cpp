@@ -8,6 +8,37 @@
 
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
+#include <algorithm>
+#include <numeric>
+
+#include "cryptography/ed25519_sha3_impl/internal/keccak_lanes.hpp"
+
+namespace {
+  using LanesFunction = void (*)(uint8_t *const *,
+                                 const uint8_t *const *,
+                                 const size_t *,
+                                 size_t);
+
+  struct Lanes {
+    size_t count;
+    LanesFunction function;
+  };
+
+  /// @return the widest implementation of SHA3-256 in SIMD lanes, which is
+  /// supported by the CPU
+  Lanes selectLanes() {
+#ifdef IROHA_KECCAK_LANES
+    if (__builtin_cpu_supports("avx512f")) {
+      return {8, iroha::keccak::sha3_256_x8};
+    }
+    if (__builtin_cpu_supports("avx2")) {
+      return {4, iroha::keccak::sha3_256_x4};
+    }
+#endif
+    return {1, nullptr};
+  }
+}  // namespace
+
 namespace iroha {
 
   void sha3_256(uint8_t *output, const uint8_t *input, size_t in_size) {
@@ -55,4 +86,46 @@ namespace iroha {
     sha3_256(h.data(), msg.data(), msg.size());
     return h;
   }
+
+  void sha3_256(uint8_t *const *outputs,
+                const uint8_t *const *inputs,
+                const size_t *in_sizes,
+                size_t count) {
+    static const Lanes lanes = selectLanes();
+    if (lanes.count == 1) {
+      for (size_t i = 0; i < count; ++i) {
+        sha3_256(outputs[i], inputs[i], in_sizes[i]);
+      }
+      return;
+    }
+
+    // inputs with the same number of blocks are grouped, so that lanes are
+    // not permuted after their input is absorbed
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+      return in_sizes[lhs] / keccak::kSha3_256Rate
+          < in_sizes[rhs] / keccak::kSha3_256Rate;
+    });
+
+    std::vector<uint8_t *> group_outputs(lanes.count);
+    std::vector<const uint8_t *> group_inputs(lanes.count);
+    std::vector<size_t> group_sizes(lanes.count);
+    for (size_t begin = 0; begin < count; begin += lanes.count) {
+      auto group = std::min(lanes.count, count - begin);
+      if (group == 1) {
+        auto i = order[begin];
+        sha3_256(outputs[i], inputs[i], in_sizes[i]);
+        continue;
+      }
+      for (size_t lane = 0; lane < group; ++lane) {
+        auto i = order[begin + lane];
+        group_outputs[lane] = outputs[i];
+        group_inputs[lane] = inputs[i];
+        group_sizes[lane] = in_sizes[i];
+      }
+      lanes.function(
+          group_outputs.data(), group_inputs.data(), group_sizes.data(), group);
+    }
+  }
 }  // namespace iroha
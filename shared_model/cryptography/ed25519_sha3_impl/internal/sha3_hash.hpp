@@ -22,6 +22,20 @@ namespace iroha {
   hash512_t sha3_512(const uint8_t *input, size_t in_size);
   hash512_t sha3_512(const std::string &msg);
   hash512_t sha3_512(const std::vector<uint8_t> &msg);
+
+  /**
+   * Compute SHA3-256 of several inputs. Inputs of similar size are hashed
+   * together in the lanes of AVX-512 or AVX2 registers, when the CPU supports
+   * them, and one by one otherwise.
+   * @param outputs - 32-byte output of each input
+   * @param inputs - inputs to hash
+   * @param in_sizes - size of each input
+   * @param count - number of inputs
+   */
+  void sha3_256(uint8_t *const *outputs,
+                const uint8_t *const *inputs,
+                const size_t *in_sizes,
+                size_t count);
 }  // namespace iroha
 
 #endif  // IROHA_HASH_H
@@ -18,7 +18,8 @@ namespace shared_model {
     class Hash : public Blob {
      public:
       /**
-       * To calculate hash used by some standard containers
+       * To calculate hash used by some standard containers. Leading bytes of
+       * hashes of the hash provider size are used without hashing
        */
       struct Hasher {
         std::size_t operator()(Hash const &h) const;
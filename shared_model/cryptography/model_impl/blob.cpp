@@ -5,6 +5,8 @@
 
 #include "cryptography/blob.hpp"
 
+#include <memory>
+
 #include "common/byteutils.hpp"
 
 namespace shared_model {
@@ -19,9 +21,7 @@ namespace shared_model {
 
     Blob::Blob(const Bytes &blob) : Blob(Bytes(blob)) {}
 
-    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {
-      iroha::bytestringToHexstringAppend(range(), hex_);
-    }
+    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {}
 
     Blob::Blob(shared_model::interface::types::ByteRange range)
         : blob_(reinterpret_cast<const Bytes::value_type *>(range.data()),
@@ -29,7 +29,32 @@ namespace shared_model {
                     + range.size()) {
       static_assert(sizeof(range.data()[0]) == sizeof(Bytes::value_type),
                     "type mismatch");
-      iroha::bytestringToHexstringAppend(range, hex_);
+    }
+
+    // hex representation is not copied, since it may be being made by another
+    // thread; the copy makes its own when it is needed
+    Blob::Blob(const Blob &other) : blob_(other.blob_) {}
+
+    Blob::Blob(Blob &&other) noexcept
+        : blob_(std::move(other.blob_)),
+          hex_(other.hex_.exchange(nullptr, std::memory_order_acq_rel)) {}
+
+    Blob::~Blob() {
+      delete hex_.load(std::memory_order_acquire);
+    }
+
+    Blob &Blob::operator=(const Blob &other) {
+      return *this = Blob(other);
+    }
+
+    Blob &Blob::operator=(Blob &&other) noexcept {
+      if (this != &other) {
+        blob_ = std::move(other.blob_);
+        delete hex_.exchange(
+            other.hex_.exchange(nullptr, std::memory_order_acq_rel),
+            std::memory_order_acq_rel);
+      }
+      return *this;
     }
 
     Blob *Blob::clone() const {
@@ -56,7 +81,20 @@ namespace shared_model {
     }
 
     const std::string &Blob::hex() const {
-      return hex_;
+      auto hex = hex_.load(std::memory_order_acquire);
+      if (hex == nullptr) {
+        // threads calling hex() at the same time make their own strings, and
+        // all of them return the one stored first
+        auto made = std::make_unique<std::string>();
+        iroha::bytestringToHexstringAppend(range(), *made);
+        if (hex_.compare_exchange_strong(hex,
+                                         made.get(),
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+          hex = made.release();
+        }
+      }
+      return *hex;
     }
 
     size_t Blob::size() const {
@@ -5,9 +5,15 @@
 
 #include "cryptography/hash.hpp"
 
+#include <cstring>
 #include <functional>
 #include <string>
 
+namespace {
+  /// size of hashes made by the hash provider
+  constexpr size_t kHashSize = 32;
+}  // namespace
+
 namespace shared_model {
   namespace crypto {
 
@@ -30,6 +36,13 @@ namespace shared_model {
 
     std::size_t Hash::Hasher::operator()(Hash const &h) const {
       auto const &blob = h.blob();
+      // bytes of a real hash are already uniformly distributed, so the
+      // leading ones are used as is instead of hashing all of them again
+      if (blob.size() == kHashSize) {
+        std::size_t result;
+        std::memcpy(&result, blob.data(), sizeof(result));
+        return result;
+      }
       std::string_view sv;
       if (!blob.empty()) {
         sv = {reinterpret_cast<std::string_view::const_pointer>(blob.data()),
@@ -133,6 +133,11 @@ namespace shared_model {
       static auto makeHash(const types::BlobType &payload) {
         return HashProvider::makeHash(payload);
       }
+
+      static auto makeHashes(
+          const std::vector<const types::BlobType *> &payloads) {
+        return HashProvider::makeHashes(payloads);
+      }
     };
 
   }  // namespace interface
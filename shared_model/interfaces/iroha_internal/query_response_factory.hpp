@@ -48,6 +48,8 @@ namespace shared_model {
        * @param next_asset_id if there are more assets ofter the provided ones,
        * this specifies the id of the first following asset; otherwise none
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return account asset response
        */
       virtual std::unique_ptr<QueryResponse> createAccountAssetResponse(
@@ -57,7 +59,8 @@ namespace shared_model {
           size_t total_assets_number,
           std::optional<shared_model::interface::types::AssetIdType>
               next_asset_id,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for account detail query
@@ -66,6 +69,8 @@ namespace shared_model {
        * query, regardless of pagination metadata
        * @param next_record_id the next record id, if any
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return account detail response
        */
       virtual std::unique_ptr<QueryResponse> createAccountDetailResponse(
@@ -74,7 +79,8 @@ namespace shared_model {
           std::optional<std::reference_wrapper<
               const shared_model::interface::AccountDetailRecordId>>
               next_record_id,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for account query
@@ -84,6 +90,8 @@ namespace shared_model {
        * @param jsonData of account to be inserted into the response
        * @param roles to be inserted into the response
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return account response
        */
       virtual std::unique_ptr<QueryResponse> createAccountResponse(
@@ -92,17 +100,21 @@ namespace shared_model {
           interface::types::QuorumType quorum,
           interface::types::JsonType jsonData,
           std::vector<std::string> roles,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for get block query
        * @param block to be inserted into the response
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return block response
        */
       virtual std::unique_ptr<QueryResponse> createBlockResponse(
           std::unique_ptr<Block> block,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Describes type of error to be placed inside the error query response
@@ -124,34 +136,43 @@ namespace shared_model {
        * @param error_msg - message, which is to be set in the response
        * @param error_code - stateful error code to be set in the response
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return error response
        */
       virtual std::unique_ptr<QueryResponse> createErrorQueryResponse(
           ErrorQueryType error_type,
           ErrorQueryResponse::ErrorMessageType error_msg,
           ErrorQueryResponse::ErrorCodeType error_code,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for signatories query
        * @param signatories to be inserted into the response
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return signatories response
        */
       virtual std::unique_ptr<QueryResponse> createSignatoriesResponse(
           std::vector<std::string> signatories,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for transactions query
        * @param transactions to be inserted into the response
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return transactions response
        */
       virtual std::unique_ptr<QueryResponse> createTransactionsResponse(
           std::vector<std::unique_ptr<shared_model::interface::Transaction>>
               transactions,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for transactions pagination query
@@ -161,6 +182,8 @@ namespace shared_model {
        * @param all_transactions_size - total number of transactions
        * for this query
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return transactions response
        */
       virtual std::unique_ptr<QueryResponse> createTransactionsPageResponse(
@@ -169,7 +192,8 @@ namespace shared_model {
           std::optional<std::reference_wrapper<const crypto::Hash>>
               next_tx_hash,
           interface::types::TransactionsNumberType all_transactions_size,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create paged response for pending transaction query
@@ -179,6 +203,8 @@ namespace shared_model {
        * @param next_batch_info - optional struct with hash of the first
        * transaction for the following batch and its size (if exists)
        * @param query_hash - hash of the corresponding query
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        */
       virtual std::unique_ptr<QueryResponse>
       createPendingTransactionsPageResponse(
@@ -186,7 +212,8 @@ namespace shared_model {
           interface::types::TransactionsNumberType all_transactions_size,
           std::optional<interface::PendingTransactionsPageResponse::BatchInfo>
               next_batch_info,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for asset query
@@ -195,53 +222,69 @@ namespace shared_model {
        * @param precision of asset to be inserted into the response
        * @param query_hash - hash of the query, for which response is
        * created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return asset response
        */
       virtual std::unique_ptr<QueryResponse> createAssetResponse(
           types::AssetIdType asset_id,
           types::DomainIdType domain_id,
           types::PrecisionType precision,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for roles query
        * @param roles to be inserted into the response
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return roles response
        */
       virtual std::unique_ptr<QueryResponse> createRolesResponse(
           std::vector<types::RoleIdType> roles,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for role permissions query
        * @param role_permissions to be inserted into the response
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return role permissions response
        */
       virtual std::unique_ptr<QueryResponse> createRolePermissionsResponse(
           RolePermissionSet role_permissions,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for get peers query
        * @param peers - list of peers
        * @param query_hash - hash of the query, for which response is created
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return get peers response
        */
       virtual std::unique_ptr<QueryResponse> createPeersResponse(
-          types::PeerList peers, const crypto::Hash &query_hash) const = 0;
+          types::PeerList peers,
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for EVM response
        * @param engine_response_records a vector of EVM responses for commands
        * within a transaction
+       * @param height - height of the ledger state the response is made
+       * from, 0 if unknown
        * @return response message for a transaction
        */
       virtual std::unique_ptr<QueryResponse> createEngineReceiptsResponse(
           const std::vector<std::unique_ptr<EngineReceipt>>
               &engine_response_records,
-          const crypto::Hash &query_hash) const = 0;
+          const crypto::Hash &query_hash,
+          types::HeightType height) const = 0;
 
       /**
        * Create response for block query with block
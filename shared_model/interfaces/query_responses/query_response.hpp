@@ -66,6 +66,12 @@ namespace shared_model {
        */
       virtual const interface::types::HashType &queryHash() const = 0;
 
+      /**
+       * @return height of the ledger state the response was made from, 0 if
+       * unknown
+       */
+      virtual interface::types::HeightType height() const = 0;
+
       // ------------------------| Primitive override |-------------------------
 
       std::string toString() const override;
@@ -0,0 +1,116 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Compression of serialized blocks as they are written to the flat file block
+ * storage. Reports the compression ratio with and without the dictionary
+ * built from previous blocks, and the compression and decompression
+ * throughput.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/flat_file/block_compressor.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "common/byteutils.hpp"
+#include "datetime/time.hpp"
+#include "framework/test_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using iroha::ametsuchi::BlockCompressor;
+
+/// number of transactions in a single block
+constexpr int number_of_txs = 100;
+
+class BlockCompressionBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    shared_model::proto::ProtoBlockJsonConverter converter;
+    for (size_t height = 1; height <= BlockCompressor::kTrainingBlocks + 1;
+         ++height) {
+      std::vector<shared_model::proto::Transaction> txs;
+      for (int i = 0; i < number_of_txs; i++) {
+        txs.push_back(TestTransactionBuilder()
+                          .createdTime(iroha::time::now() + i)
+                          .creatorAccountId("player@one")
+                          .quorum(1)
+                          .transferAsset("player@one",
+                                         "player@two",
+                                         "coin#one",
+                                         "",
+                                         std::to_string(height) + ".00")
+                          .build());
+      }
+      auto block = TestBlockBuilder()
+                       .createdTime(iroha::time::now())
+                       .height(height)
+                       .transactions(txs)
+                       .build();
+      blocks.push_back(iroha::stringToBytes(
+          iroha::expected::resultToOptionalValue(converter.serialize(block))
+              .value()));
+    }
+  }
+
+  void TearDown(benchmark::State &st) override {
+    blocks.clear();
+    boost::filesystem::remove_all(path);
+  }
+
+  /// Compressor which has built its dictionary from all but the last block
+  std::unique_ptr<BlockCompressor> trainedCompressor() {
+    auto compressor = std::move(*BlockCompressor::create(
+        path, true, getTestLogger("BlockCompressor")));
+    for (size_t i = 0; i + 1 < blocks.size(); ++i) {
+      compressor->compress(blocks[i]);
+    }
+    return compressor;
+  }
+
+  std::vector<BlockCompressor::Bytes> blocks;
+  const std::string path = (boost::filesystem::temp_directory_path()
+                            / boost::filesystem::unique_path())
+                               .string();
+};
+
+BENCHMARK_DEFINE_F(BlockCompressionBenchmark, Compress)
+(benchmark::State &state) {
+  auto compressor = std::move(
+      *BlockCompressor::create(path, true, getTestLogger("BlockCompressor")));
+  const auto &first_block = blocks.front();
+  state.counters["ratio_without_dictionary"] =
+      double(first_block.size()) / compressor->compress(first_block).size();
+
+  for (size_t i = 1; i + 1 < blocks.size(); ++i) {
+    compressor->compress(blocks[i]);
+  }
+  const auto &block = blocks.back();
+  state.counters["ratio_with_dictionary"] =
+      double(block.size()) / compressor->compress(block).size();
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(compressor->compress(block));
+  }
+  state.SetBytesProcessed(state.iterations() * block.size());
+}
+
+BENCHMARK_DEFINE_F(BlockCompressionBenchmark, DecompressWithDictionary)
+(benchmark::State &state) {
+  auto compressor = trainedCompressor();
+  const auto &block = blocks.back();
+  auto compressed = compressor->compress(block);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(compressor->decompress(compressed));
+  }
+  state.SetBytesProcessed(state.iterations() * block.size());
+}
+
+BENCHMARK_REGISTER_F(BlockCompressionBenchmark, Compress);
+BENCHMARK_REGISTER_F(BlockCompressionBenchmark, DecompressWithDictionary);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Cost of crypto::Blob and crypto::Hash, which are made for every
+ * transaction, signature and block. Besides the time, every benchmark reports
+ * the number of heap allocations and allocated bytes per iteration.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <unordered_set>
+
+#include "cryptography/hash.hpp"
+#include "cryptography/hash_providers/sha3_256.hpp"
+
+namespace {
+  std::atomic<size_t> allocations{0};
+  std::atomic<size_t> allocated_bytes{0};
+
+  /// Reports allocations made since the construction per iteration
+  class AllocationCounter {
+   public:
+    explicit AllocationCounter(benchmark::State &state)
+        : state_(state),
+          allocations_(allocations.load()),
+          allocated_bytes_(allocated_bytes.load()) {}
+
+    ~AllocationCounter() {
+      auto iterations = static_cast<double>(state_.iterations());
+      state_.counters["allocs"] =
+          (allocations.load() - allocations_) / iterations;
+      state_.counters["bytes"] =
+          (allocated_bytes.load() - allocated_bytes_) / iterations;
+    }
+
+   private:
+    benchmark::State &state_;
+    size_t allocations_;
+    size_t allocated_bytes_;
+  };
+
+  shared_model::crypto::Hash makeHash(size_t i) {
+    return shared_model::crypto::Sha3_256::makeHash(
+        shared_model::crypto::Blob(std::to_string(i)));
+  }
+}  // namespace
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  allocated_bytes += size;
+  if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+/// Hash of a payload, as it is made for every transaction
+static void BM_MakeHash(benchmark::State &state) {
+  shared_model::crypto::Blob payload(std::string(256, 'a'));
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(shared_model::crypto::Sha3_256::makeHash(payload));
+  }
+}
+BENCHMARK(BM_MakeHash);
+
+/// Copy of a hash, as it is stored in caches and sets
+static void BM_CopyHash(benchmark::State &state) {
+  auto hash = makeHash(0);
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    shared_model::crypto::Hash copy(hash);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_CopyHash);
+
+/// Hex representation of a new hash, as it is made for logging and SQL
+static void BM_HashHex(benchmark::State &state) {
+  auto hash = makeHash(0);
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    shared_model::crypto::Hash copy(hash);
+    benchmark::DoNotOptimize(copy.hex());
+  }
+}
+BENCHMARK(BM_HashHex);
+
+/// Lookup of hashes in an unordered set, as in the caches of the ordering
+/// service and of transaction presence
+static void BM_HashSetLookup(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::unordered_set<shared_model::crypto::Hash,
+                     shared_model::crypto::Hash::Hasher>
+      set;
+  std::vector<shared_model::crypto::Hash> hashes;
+  for (size_t i = 0; i < size; ++i) {
+    hashes.push_back(makeHash(i));
+    set.insert(hashes.back());
+  }
+  AllocationCounter counter(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.count(hashes[i++ % size]));
+  }
+}
+BENCHMARK(BM_HashSetLookup)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,167 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Loading of a genesis block with the given number of accounts from a JSON
+ * block, a binary protobuf block and a file with a JSON transaction per line.
+ * Besides the time, every benchmark reports the peak of heap memory in use
+ * during the loading, which dominates the memory of the daemon startup.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <malloc.h>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+#include <google/protobuf/util/json_util.h>
+#include <boost/filesystem.hpp>
+#include "block.pb.h"
+#include "common/result.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "main/raw_block_loader.hpp"
+
+namespace {
+  std::atomic<size_t> heap_in_use{0};
+  std::atomic<size_t> heap_peak{0};
+
+  enum Format { kJson, kBinary, kTransactions };
+
+  /// Reports the peak of heap memory in use since the construction
+  class PeakHeapCounter {
+   public:
+    explicit PeakHeapCounter(benchmark::State &state)
+        : state_(state), initial_(heap_in_use.load()) {
+      heap_peak = initial_;
+    }
+
+    ~PeakHeapCounter() {
+      state_.counters["peak_mb"] =
+          static_cast<double>(heap_peak.load() - initial_) / (1 << 20);
+    }
+
+   private:
+    benchmark::State &state_;
+    size_t initial_;
+  };
+
+  iroha::protocol::Transaction makeTransaction(size_t i) {
+    iroha::protocol::Transaction tx;
+    auto &payload = *tx.mutable_payload()->mutable_reduced_payload();
+    payload.set_creator_account_id("admin@test");
+    payload.set_created_time(i);
+    payload.set_quorum(1);
+    auto &create_account = *payload.add_commands()->mutable_create_account();
+    create_account.set_account_name("account" + std::to_string(i));
+    create_account.set_domain_id("test");
+    create_account.set_public_key(std::string(64, 'a'));
+    auto &add_asset = *payload.add_commands()->mutable_add_asset_quantity();
+    add_asset.set_asset_id("coin#test");
+    add_asset.set_amount("1000.0");
+    return tx;
+  }
+
+  /// Write the genesis block with the given number of accounts in the format
+  /// @return path to the file
+  std::string writeGenesis(Format format, size_t accounts) {
+    auto path = (boost::filesystem::temp_directory_path()
+                 / boost::filesystem::unique_path())
+                    .string();
+    std::ofstream file;
+    if (format == kTransactions) {
+      path += iroha::main::BlockLoader::kTransactionsExtension;
+      file.open(path);
+      for (size_t i = 0; i < accounts; ++i) {
+        std::string json;
+        google::protobuf::util::MessageToJsonString(makeTransaction(i), &json);
+        file << json << '\n';
+      }
+      return path;
+    }
+
+    iroha::protocol::Block block;
+    auto &payload = *block.mutable_block_v1()->mutable_payload();
+    for (size_t i = 0; i < accounts; ++i) {
+      *payload.add_transactions() = makeTransaction(i);
+    }
+    payload.set_height(1);
+    payload.set_prev_block_hash(std::string(64, '0'));
+    payload.set_tx_number(accounts);
+    file.open(path, std::ios::binary);
+    if (format == kBinary) {
+      block.SerializeToOstream(&file);
+    } else {
+      std::string json;
+      google::protobuf::util::MessageToJsonString(block, &json);
+      file << json;
+    }
+    return path;
+  }
+}  // namespace
+
+void *operator new(std::size_t size) {
+  if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+    auto in_use = heap_in_use += malloc_usable_size(ptr);
+    auto peak = heap_peak.load();
+    while (in_use > peak and not heap_peak.compare_exchange_weak(peak, in_use))
+      ;
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+  if (ptr) {
+    heap_in_use -= malloc_usable_size(ptr);
+  }
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  operator delete(ptr);
+}
+
+/**
+ * Loads the genesis block from the file
+ * @param state - range(0) is the Format, range(1) is the number of accounts
+ */
+static void BM_LoadGenesis(benchmark::State &state) {
+  const auto format = static_cast<Format>(state.range(0));
+  const auto accounts = static_cast<size_t>(state.range(1));
+  const auto path = writeGenesis(format, accounts);
+
+  {
+    PeakHeapCounter counter(state);
+    for (auto _ : state) {
+      auto block = iroha::main::BlockLoader::loadBlock(path);
+      if (iroha::expected::hasError(block)) {
+        state.SkipWithError(block.assumeError().c_str());
+        break;
+      }
+      benchmark::DoNotOptimize(block.assumeValue()->hash());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * accounts);
+  state.counters["file_mb"] =
+      static_cast<double>(boost::filesystem::file_size(path)) / (1 << 20);
+  boost::filesystem::remove(path);
+}
+
+static void genesisArguments(benchmark::internal::Benchmark *b) {
+  for (auto format : {kJson, kBinary, kTransactions}) {
+    for (auto accounts : {1000, 10000, 100000}) {
+      b->Args({format, accounts});
+    }
+  }
+}
+
+BENCHMARK(BM_LoadGenesis)
+    ->ArgNames({"format", "accounts"})
+    ->Apply(genesisArguments)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,124 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+#include "common/blob.hpp"
+#include "logger/logger_spdlog.hpp"
+
+/**
+ * Measures the logging overhead of a block application: one info message with
+ * the block hash and a debug message for each of its batches.
+ */
+
+namespace {
+  constexpr size_t kBatchesPerBlock = 100;
+
+  iroha::blob_t<32> makeHash() {
+    iroha::blob_t<32> hash;
+    hash.fill(0xAB);
+    return hash;
+  }
+
+  /// Create a logger which writes to a null sink instead of the console
+  std::shared_ptr<logger::Logger> makeLogger(
+      const std::string &tag,
+      logger::LogLevel level,
+      boost::optional<logger::AsyncLoggingConfig> async) {
+    auto log = std::make_shared<logger::LoggerSpdlog>(
+        tag,
+        std::make_shared<const logger::LoggerConfig>(logger::LoggerConfig{
+            level, logger::getDefaultLogPatterns(), async}));
+    spdlog::get(tag)->sinks().assign(
+        {std::make_shared<spdlog::sinks::null_sink_mt>()});
+    return log;
+  }
+
+  /// Arguments formatted before the level check, as it was done before
+  void logBlockEager(const logger::Logger &log,
+                     size_t height,
+                     const iroha::blob_t<32> &hash) {
+    log.info(std::string("Applying block: height {}, hash {}"),
+             height,
+             hash.to_hexstring());
+    for (size_t i = 0; i < kBatchesPerBlock; ++i) {
+      log.debug(
+          std::string("check batch {} for already processed transactions"),
+          hash.to_hexstring());
+    }
+  }
+
+  /// Arguments computed only for the enabled levels
+  void logBlockLazy(const logger::Logger &log,
+                    size_t height,
+                    const iroha::blob_t<32> &hash) {
+    log.info("Applying block: height {}, hash {}",
+             height,
+             logger::lazy([&hash] { return hash.to_hexstring(); }));
+    for (size_t i = 0; i < kBatchesPerBlock; ++i) {
+      log.debug("check batch {} for already processed transactions",
+                logger::lazy([&hash] { return hash.to_hexstring(); }));
+    }
+  }
+
+  template <typename LogBlock>
+  void runBlockLogging(benchmark::State &state,
+                       const std::string &tag,
+                       logger::LogLevel level,
+                       boost::optional<logger::AsyncLoggingConfig> async,
+                       LogBlock log_block) {
+    auto log = makeLogger(tag, level, std::move(async));
+    auto hash = makeHash();
+    size_t height = 0;
+
+    while (state.KeepRunning()) {
+      log_block(*log, ++height, hash);
+    }
+  }
+}  // namespace
+
+static void BM_BlockLoggingEager(benchmark::State &state) {
+  runBlockLogging(
+      state, "eager", logger::LogLevel::kInfo, boost::none, logBlockEager);
+}
+BENCHMARK(BM_BlockLoggingEager);
+
+static void BM_BlockLoggingLazy(benchmark::State &state) {
+  runBlockLogging(
+      state, "lazy", logger::LogLevel::kInfo, boost::none, logBlockLazy);
+}
+BENCHMARK(BM_BlockLoggingLazy);
+
+static void BM_BlockLoggingLazyAsync(benchmark::State &state) {
+  runBlockLogging(state,
+                  "lazy_async",
+                  logger::LogLevel::kInfo,
+                  logger::AsyncLoggingConfig{},
+                  logBlockLazy);
+}
+BENCHMARK(BM_BlockLoggingLazyAsync);
+
+/// All the messages enabled and written synchronously
+static void BM_BlockLoggingDebugSync(benchmark::State &state) {
+  runBlockLogging(
+      state, "debug_sync", logger::LogLevel::kDebug, boost::none, logBlockLazy);
+}
+BENCHMARK(BM_BlockLoggingDebugSync);
+
+/// All the messages enabled and written by the background thread
+static void BM_BlockLoggingDebugAsync(benchmark::State &state) {
+  runBlockLogging(state,
+                  "debug_async",
+                  logger::LogLevel::kDebug,
+                  logger::AsyncLoggingConfig{},
+                  logBlockLazy);
+}
+BENCHMARK(BM_BlockLoggingDebugAsync);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,130 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Contention of the pending transactions storage, as it is used by the MST
+ * processor, the queries and the pipeline at the same time. Each thread
+ * inserts batches of two creators as MST updates, queries pages of pending
+ * transactions, updates the batches with new signatures and removes them by
+ * the hash of their second transaction as finalized. The threads either work
+ * with accounts of their own or with the same pair of accounts.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+#include <rxcpp/rx-lite.hpp>
+#include "framework/test_logger.hpp"
+#include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
+#include "multi_sig_transactions/state/mst_state.hpp"
+#include "pending_txs_storage/impl/pending_txs_storage_impl.hpp"
+
+namespace {
+  constexpr size_t kBatchesPerThread = 500;
+  constexpr shared_model::interface::types::TransactionsNumberType kPageSize =
+      10;
+
+  struct ThreadBatches {
+    std::string creator;
+    std::vector<std::shared_ptr<iroha::MstState>> states;
+    std::vector<shared_model::interface::types::HashType> finalized;
+  };
+
+  /**
+   * Make the MST updates of a thread, each with a batch of two transactions
+   * @param thread - index of the thread
+   * @param shared_accounts - whether the creators are the same for all threads
+   */
+  ThreadBatches makeThreadBatches(size_t thread, bool shared_accounts) {
+    static auto completer = std::make_shared<iroha::DefaultCompleter>(
+        std::chrono::minutes(0));
+    static auto log = getTestLogger("MstState");
+
+    const auto suffix = shared_accounts ? "" : std::to_string(thread);
+    ThreadBatches result;
+    result.creator = "alice" + suffix + "@iroha";
+    const auto time = iroha::time::now() + thread * kBatchesPerThread * 2;
+    for (size_t i = 0; i < kBatchesPerThread; ++i) {
+      auto batch = makeTestBatch(
+          txBuilder(2, time + i * 2, 2, result.creator),
+          txBuilder(2, time + i * 2 + 1, 2, "bob" + suffix + "@iroha"));
+      result.finalized.push_back(batch->transactions().back()->hash());
+      auto state = std::make_shared<iroha::MstState>(
+          iroha::MstState::empty(log, completer));
+      *state += batch;
+      result.states.push_back(std::move(state));
+    }
+    return result;
+  }
+}  // namespace
+
+/**
+ * @param state - range(0) is the number of threads, range(1) is 1 if the
+ * threads use the same accounts
+ */
+static void BM_PendingTxsContention(benchmark::State &state) {
+  const auto threads = static_cast<size_t>(state.range(0));
+  const bool shared_accounts = state.range(1) != 0;
+
+  std::vector<ThreadBatches> batches;
+  for (size_t t = 0; t < threads; ++t) {
+    batches.push_back(makeThreadBatches(t, shared_accounts));
+  }
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    rxcpp::subjects::subject<std::shared_ptr<iroha::MstState>> updates;
+    rxcpp::subjects::subject<shared_model::interface::types::HashType>
+        finalized;
+    auto storage = iroha::PendingTransactionStorageImpl::create(
+        updates.get_observable(),
+        rxcpp::observable<>::empty<
+            std::shared_ptr<shared_model::interface::TransactionBatch>>(),
+        rxcpp::observable<>::empty<
+            std::shared_ptr<shared_model::interface::TransactionBatch>>(),
+        rxcpp::observable<>::empty<
+            std::pair<shared_model::interface::types::AccountIdType,
+                      shared_model::interface::types::HashType>>(),
+        finalized.get_observable());
+    state.ResumeTiming();
+
+    std::vector<std::thread> workers;
+    for (const auto &thread_batches : batches) {
+      workers.emplace_back([&] {
+        auto updates_subscriber = updates.get_subscriber();
+        auto finalized_subscriber = finalized.get_subscriber();
+        for (size_t i = 0; i < kBatchesPerThread; ++i) {
+          updates_subscriber.on_next(thread_batches.states[i]);
+          benchmark::DoNotOptimize(storage->getPendingTransactions(
+              thread_batches.creator, kPageSize, std::nullopt));
+          // the same batch again, as it comes with new signatures
+          updates_subscriber.on_next(thread_batches.states[i]);
+          finalized_subscriber.on_next(thread_batches.finalized[i]);
+        }
+      });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * threads * kBatchesPerThread);
+}
+
+static void contentionArguments(benchmark::internal::Benchmark *b) {
+  for (auto threads : {1, 2, 4, 8}) {
+    for (auto shared_accounts : {0, 1}) {
+      b->Args({threads, shared_accounts});
+    }
+  }
+}
+
+BENCHMARK(BM_PendingTxsContention)
+    ->ArgNames({"threads", "shared_accounts"})
+    ->Apply(contentionArguments)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
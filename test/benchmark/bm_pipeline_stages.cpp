@@ -0,0 +1,341 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Full single node pipeline with the time each transaction spends in every
+ * stage: from sending to the acceptance by torii, then to the proposal made
+ * by the ordering service, to the verified proposal, to the block signed by
+ * the simulator, to the consensus outcome, to the commit of the block and its
+ * WSV changes, and to the committed status. The node runs without background
+ * indexing, so the commit stage also includes the transaction position
+ * indexes. With background_indexing they are written after the commit and are
+ * not measured here. The benchmarks run a fixed number of iterations over
+ * proposal sizes and command mixes. The percentiles of each stage are printed
+ * as a table and reported as counters, so that --benchmark_out_format=json
+ * gives them for regression tracking.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <ciso646>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+#include <fmt/format.h>
+#include "backend/protobuf/transaction.hpp"
+#include "benchmark/bm_utils.hpp"
+#include "builders/protobuf/unsigned_proto.hpp"
+#include "common/visitor.hpp"
+#include "consensus/gate_object.hpp"
+#include "datetime/time.hpp"
+#include "framework/integration_framework/integration_test_framework.hpp"
+#include "framework/integration_framework/iroha_instance.hpp"
+#include "framework/integration_framework/test_irohad.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/iroha_internal/proposal.hpp"
+#include "interfaces/transaction_responses/committed_tx_response.hpp"
+#include "interfaces/transaction_responses/enough_signatures_collected_response.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "network/consensus_gate.hpp"
+#include "network/ordering_gate_common.hpp"
+#include "network/peer_communication_service.hpp"
+#include "simulator/impl/simulator.hpp"
+#include "validation/stateful_validator_common.hpp"
+
+using namespace benchmark::utils;
+using namespace common_constants;
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  enum Stage {
+    kSent,
+    kToriiAccept,
+    kOrderingPack,
+    kProposalValidation,
+    kBlockSign,
+    kConsensus,
+    kCommit,
+    kCommittedStatus,
+    kStagesCount
+  };
+
+  const std::array<const char *, kStagesCount> kStageNames{"sent",
+                                                           "torii_accept",
+                                                           "ordering_pack",
+                                                           "validation",
+                                                           "block_sign",
+                                                           "consensus",
+                                                           "commit",
+                                                           "status"};
+
+  /// Commands of the transactions, selected by the second benchmark argument
+  enum CommandMix { kTransfer, kAddAssetQuantity, kSetDetail, kMixed };
+
+  /**
+   * Time of each stage reached by the transactions sent in the benchmark.
+   * Stages are marked from the pipeline threads.
+   */
+  class StageRecorder {
+   public:
+    using Hash = shared_model::crypto::Hash;
+    using Times = std::array<boost::optional<Clock::time_point>, kStagesCount>;
+
+    void sent(const Hash &hash) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      times_[hash][kSent] = Clock::now();
+    }
+
+    void mark(const Hash &hash, Stage stage) {
+      auto now = Clock::now();
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = times_.find(hash);
+      if (it == times_.end() or it->second[stage]) {
+        return;
+      }
+      it->second[stage] = now;
+      if (stage == kCommittedStatus) {
+        ++finished_;
+        finished_cv_.notify_all();
+      }
+    }
+
+    template <typename Transactions>
+    void markAll(const Transactions &txs, Stage stage) {
+      for (const auto &tx : txs) {
+        mark(tx.hash(), stage);
+      }
+    }
+
+    /// Wait until the given number of transactions reach the last stage
+    bool waitFinished(size_t count, std::chrono::seconds timeout) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      return finished_cv_.wait_for(
+          lock, timeout, [&] { return finished_ >= count; });
+    }
+
+    /// @return time spent in the stage by each transaction which has
+    /// passed all stages
+    std::vector<Clock::duration> stageDurations(Stage stage) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::vector<Clock::duration> durations;
+      for (const auto &hash_times : times_) {
+        const auto &times = hash_times.second;
+        auto passed = std::all_of(times.begin(),
+                                  times.end(),
+                                  [](const auto &t) { return bool(t); });
+        if (not passed) {
+          continue;
+        }
+        if (stage == kSent) {
+          durations.push_back(*times[kCommittedStatus] - *times[kSent]);
+        } else {
+          durations.push_back(*times[stage] - *times[stage - 1]);
+        }
+      }
+      std::sort(durations.begin(), durations.end());
+      return durations;
+    }
+
+   private:
+    mutable std::mutex mutex_;
+    std::condition_variable finished_cv_;
+    std::unordered_map<Hash, Times, Hash::Hasher> times_;
+    size_t finished_ = 0;
+  };
+
+  double percentileMs(const std::vector<Clock::duration> &sorted, double p) {
+    if (sorted.empty()) {
+      return 0;
+    }
+    auto index = static_cast<size_t>(p / 100. * (sorted.size() - 1) + 0.5);
+    return std::chrono::duration<double, std::milli>(sorted[index]).count();
+  }
+
+  /// Subscribe the recorder to every stage of the pipeline
+  void subscribe(integration_framework::IntegrationTestFramework &itf,
+                 StageRecorder &recorder) {
+    auto &irohad = itf.getIrohaInstance().getIrohaInstance();
+    irohad->getStatusBus()->statuses().subscribe([&recorder](auto response) {
+      iroha::visit_in_place(
+          response->get(),
+          [&](const shared_model::interface::EnoughSignaturesCollectedResponse
+                  &) {
+            recorder.mark(response->transactionHash(), kToriiAccept);
+          },
+          [&](const shared_model::interface::CommittedTxResponse &) {
+            recorder.mark(response->transactionHash(), kCommittedStatus);
+          },
+          [](const auto &) {});
+    });
+    irohad->getPeerCommunicationService()->onProposal().subscribe(
+        [&recorder](const iroha::network::OrderingEvent &event) {
+          if (event.proposal) {
+            recorder.markAll((*event.proposal)->transactions(), kOrderingPack);
+          }
+        });
+    irohad->getPeerCommunicationService()->onVerifiedProposal().subscribe(
+        [&recorder](const iroha::simulator::VerifiedProposalCreatorEvent
+                        &event) {
+          if (event.verified_proposal_result) {
+            recorder.markAll((*event.verified_proposal_result)
+                                 ->verified_proposal->transactions(),
+                             kProposalValidation);
+          }
+        });
+    irohad->getSimulator()->onBlock().subscribe(
+        [&recorder](const iroha::simulator::BlockCreatorEvent &event) {
+          if (event.round_data) {
+            recorder.markAll(event.round_data->block->transactions(),
+                             kBlockSign);
+          }
+        });
+    irohad->getConsensusGate()->onOutcome().subscribe(
+        [&recorder](const iroha::consensus::GateObject &object) {
+          if (auto pair = boost::get<iroha::consensus::PairValid>(&object)) {
+            recorder.markAll(pair->block->transactions(), kConsensus);
+          }
+        });
+    irohad->getStorage()->on_commit().subscribe([&recorder](auto block) {
+      recorder.markAll(block->transactions(), kCommit);
+    });
+  }
+
+  shared_model::proto::Transaction makeTx(CommandMix mix, size_t index) {
+    auto builder = TestUnsignedTransactionBuilder()
+                       .creatorAccountId(kUserId)
+                       .createdTime(iroha::time::now() + index)
+                       .quorum(1);
+    auto command =
+        mix == kMixed ? static_cast<CommandMix>(index % kMixed) : mix;
+    switch (command) {
+      case kTransfer:
+        builder = builder.transferAsset(kUserId, kAdminId, kAssetId, "", "0.1");
+        break;
+      case kAddAssetQuantity:
+        builder = builder.addAssetQuantity(kAssetId, "0.1");
+        break;
+      default:
+        builder = builder.setAccountDetail(
+            kUserId, "key" + std::to_string(index), "value");
+        break;
+    }
+    return builder.build().signAndAddSignature(kUserKeypair).finish();
+  }
+}  // namespace
+
+/**
+ * Sends proposal size transactions of the command mix per iteration and waits
+ * until all of them are committed
+ * @param state - range(0) is the proposal size, range(1) is the CommandMix
+ */
+static void BM_PipelineStages(benchmark::State &state) {
+  const auto proposal_size = static_cast<size_t>(state.range(0));
+  const auto mix = static_cast<CommandMix>(state.range(1));
+
+  StageRecorder recorder;
+  integration_framework::IntegrationTestFramework itf(
+      proposal_size,
+      boost::none,
+      iroha::StartupWsvDataPolicy::kDrop,
+      false,
+      false,
+      (boost::filesystem::temp_directory_path()
+       / boost::filesystem::unique_path())
+          .string(),
+      std::chrono::hours(1),
+      std::chrono::hours(1));
+  itf.setInitialState(kAdminKeypair);
+  itf.sendTx(createUserWithPerms(
+                 kUser,
+                 shared_model::interface::types::PublicKeyHexStringView{
+                     kUserKeypair.publicKey()},
+                 kRole,
+                 {shared_model::interface::permissions::Role::kAddAssetQty,
+                  shared_model::interface::permissions::Role::kTransfer,
+                  shared_model::interface::permissions::Role::kSetDetail})
+                 .build()
+                 .signAndAddSignature(kAdminKeypair)
+                 .finish())
+      .skipProposal()
+      .skipBlock();
+  itf.sendTx(TestUnsignedTransactionBuilder()
+                 .creatorAccountId(kUserId)
+                 .createdTime(iroha::time::now())
+                 .quorum(1)
+                 .addAssetQuantity(kAssetId, "1000000.0")
+                 .build()
+                 .signAndAddSignature(kUserKeypair)
+                 .finish())
+      .skipProposal()
+      .skipBlock();
+  subscribe(itf, recorder);
+
+  size_t sent = 0;
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::vector<shared_model::proto::Transaction> txs;
+    for (size_t i = 0; i < proposal_size; ++i) {
+      txs.push_back(makeTx(mix, sent + i));
+    }
+    state.ResumeTiming();
+
+    for (const auto &tx : txs) {
+      recorder.sent(tx.hash());
+      itf.sendTxWithoutValidation(tx);
+    }
+    sent += txs.size();
+    if (not recorder.waitFinished(sent, std::chrono::seconds(60))) {
+      state.SkipWithError("Transactions are not committed in time");
+      break;
+    }
+  }
+
+  std::cout << fmt::format("{:<14} {:>10} {:>10} {:>10} {:>10}\n",
+                           "stage",
+                           "p50, ms",
+                           "p90, ms",
+                           "p99, ms",
+                           "max, ms");
+  for (int stage = kSent; stage < kStagesCount; ++stage) {
+    auto durations = recorder.stageDurations(static_cast<Stage>(stage));
+    // the first row is the total time from sending to the committed status
+    auto name = stage == kSent ? "total" : kStageNames[stage];
+    std::cout << fmt::format("{:<14} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f}\n",
+                             name,
+                             percentileMs(durations, 50),
+                             percentileMs(durations, 90),
+                             percentileMs(durations, 99),
+                             percentileMs(durations, 100));
+    state.counters[fmt::format("{}_p50_ms", name)] =
+        percentileMs(durations, 50);
+    state.counters[fmt::format("{}_p99_ms", name)] =
+        percentileMs(durations, 99);
+  }
+  state.SetItemsProcessed(sent);
+  itf.done();
+}
+
+static void stageArguments(benchmark::internal::Benchmark *b) {
+  for (auto proposal_size : {10, 100, 1000}) {
+    for (auto mix : {kTransfer, kAddAssetQuantity, kSetDetail, kMixed}) {
+      b->Args({proposal_size, mix});
+    }
+  }
+}
+
+BENCHMARK(BM_PipelineStages)
+    ->ArgNames({"proposal_size", "mix"})
+    ->Apply(stageArguments)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -14,15 +14,46 @@
  *
  * Each benchmark runs transaction() and commands() call to
  * initialize possibly lazy fields.
+ *
+ * Proposal factory benchmarks compare proposals of heap allocated transport
+ * with the ones allocated on an arena, and report the number of heap
+ * allocations per proposal, including its destruction.
  */
 
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proto_proposal_factory.hpp"
 #include "datetime/time.hpp"
+#include "module/irohad/common/validators_config.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/validators/validators.hpp"
+
+namespace {
+  std::atomic<size_t> allocations{0};
+}  // namespace
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
 
 /// number of commands in a single transaction
 constexpr int number_of_commands = 5;
@@ -212,6 +243,73 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, MoveTest)(benchmark::State &st) {
   }
 }
 
+/**
+ * Transactions for the proposal factory benchmarks
+ * @param size - number of transactions
+ */
+std::vector<shared_model::proto::Transaction> makeTransactions(size_t size) {
+  auto base_tx = TestTransactionBuilder().quorum(1);
+  for (int i = 0; i < number_of_commands; i++) {
+    base_tx =
+        base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+  }
+  std::vector<shared_model::proto::Transaction> txs;
+  for (size_t i = 0; i < size; i++) {
+    txs.push_back(base_tx.createdTime(iroha::time::now() + i).build());
+  }
+  return txs;
+}
+
+/**
+ * Benchmark creation and destruction of proposal with transport allocated on
+ * heap, as it was made by the proposal factory before arenas
+ */
+static void BM_ProposalHeapTransport(benchmark::State &st) {
+  auto txs = makeTransactions(st.range(0));
+  auto initial_allocations = allocations.load();
+  for (auto _ : st) {
+    iroha::protocol::Proposal transport;
+    transport.set_height(1);
+    transport.set_created_time(iroha::time::now());
+    for (const auto &tx : txs) {
+      *transport.add_transactions() = tx.getTransport();
+    }
+    shared_model::proto::Proposal proposal(std::move(transport));
+    checkLoop(proposal);
+  }
+  st.counters["allocs"] =
+      static_cast<double>(allocations.load() - initial_allocations)
+      / st.iterations();
+}
+
+/**
+ * Benchmark creation and destruction of proposal with transport allocated on
+ * arena by the proposal factory
+ */
+static void BM_ProposalArenaTransport(benchmark::State &st) {
+  auto txs = makeTransactions(st.range(0));
+  shared_model::proto::ProtoProposalFactory<
+      shared_model::validation::AlwaysValidValidator>
+      factory(iroha::test::kTestsValidatorsConfig);
+  auto initial_allocations = allocations.load();
+  for (auto _ : st) {
+    auto proposal = factory.unsafeCreateProposal(1, iroha::time::now(), txs);
+    checkLoop(*proposal);
+  }
+  st.counters["allocs"] =
+      static_cast<double>(allocations.load() - initial_allocations)
+      / st.iterations();
+}
+
+BENCHMARK(BM_ProposalHeapTransport)
+    ->Arg(100)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ProposalArenaTransport)
+    ->Arg(100)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_REGISTER_F(BlockBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, CloneTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveTest)->UseManualTime();
@@ -4,13 +4,17 @@
  */
 
 #include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 #include <boost/variant.hpp>
+#include "backend/protobuf/proto_query_response_factory.hpp"
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "benchmark/bm_utils.hpp"
+#include "logger/dummy_logger.hpp"
 #include "module/shared_model/builders/protobuf/test_query_builder.hpp"
+#include "torii/processor/query_response_cache.hpp"
 #include "utils/query_error_response_visitor.hpp"
 
 using namespace benchmark::utils;
@@ -59,4 +63,55 @@ static void BM_QueryAccount(benchmark::State &state) {
 }
 BENCHMARK(BM_QueryAccount)->Unit(benchmark::kMicrosecond);
 
+/**
+ * This benchmark answers queries of distinct accounts round robin with the
+ * query response cache of the query processor, inserting the response on a
+ * miss, in order to measure the cost of the cache lookups and evictions
+ * @param state - range(0) is the number of distinct queries, range(1) is the
+ * capacity of the cache
+ */
+static void BM_QueryResponseCache(benchmark::State &state) {
+  const auto queries_number = static_cast<size_t>(state.range(0));
+  const shared_model::interface::types::HeightType kHeight = 1;
+
+  shared_model::proto::ProtoQueryResponseFactory response_factory;
+  std::vector<shared_model::proto::Query> queries;
+  std::vector<iroha::torii::QueryResponseCache::Key> keys;
+  for (size_t i = 0; i < queries_number; ++i) {
+    queries.push_back(TestUnsignedQueryBuilder()
+                          .createdTime(iroha::time::now())
+                          .creatorAccountId(kUserId)
+                          .queryCounter(1)
+                          .getSignatories("account" + std::to_string(i) + "@"
+                                          + kDomain)
+                          .build()
+                          .signAndAddSignature(kUserKeypair)
+                          .finish());
+    keys.push_back(*iroha::torii::QueryResponseCache::makeKey(queries.back()));
+  }
+  auto response = response_factory.createSignatoriesResponse(
+      {"signatory"}, queries.front().hash(), kHeight);
+
+  iroha::torii::QueryResponseCache cache(kHeight,
+                                         static_cast<size_t>(state.range(1)),
+                                         logger::getDummyLoggerPtr());
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    const auto &query = queries[i];
+    if (not cache.find(keys[i], query.hash())) {
+      cache.insert(keys[i], query, *response);
+    }
+    i = (i + 1) % queries_number;
+  }
+  state.counters["hit_rate"] = static_cast<double>(cache.hits())
+      / static_cast<double>(cache.hits() + cache.misses());
+  state.counters["evictions"] = static_cast<double>(cache.evictions());
+}
+BENCHMARK(BM_QueryResponseCache)
+    ->ArgNames({"queries", "capacity"})
+    ->Args({1000, 10000})
+    ->Args({10000, 10000})
+    ->Args({30000, 10000})
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
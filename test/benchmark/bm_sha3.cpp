@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * SHA3-256 of a number of blobs of the same size, e.g. payloads of the
+ * transactions of a proposal, hashed one by one and at once in SIMD lanes.
+ */
+
+#include <cstdlib>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+
+namespace {
+  constexpr size_t kBlobs = 1024;
+
+  std::vector<std::vector<uint8_t>> makeBlobs(size_t size) {
+    std::vector<std::vector<uint8_t>> blobs(kBlobs);
+    for (auto &blob : blobs) {
+      blob.reserve(size);
+      for (size_t i = 0; i < size; ++i) {
+        blob.push_back(static_cast<uint8_t>(std::rand()));
+      }
+    }
+    return blobs;
+  }
+}  // namespace
+
+static void BM_Sha3OneByOne(benchmark::State &state) {
+  auto blobs = makeBlobs(state.range(0));
+  std::vector<iroha::hash256_t> hashes(kBlobs);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < kBlobs; ++i) {
+      iroha::sha3_256(hashes[i].data(), blobs[i].data(), blobs[i].size());
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kBlobs);
+  state.SetBytesProcessed(state.iterations() * kBlobs * state.range(0));
+}
+BENCHMARK(BM_Sha3OneByOne)->RangeMultiplier(4)->Range(64, 1 << 12);
+
+static void BM_Sha3AtOnce(benchmark::State &state) {
+  auto blobs = makeBlobs(state.range(0));
+  std::vector<iroha::hash256_t> hashes(kBlobs);
+  std::vector<uint8_t *> outputs;
+  std::vector<const uint8_t *> inputs;
+  std::vector<size_t> sizes;
+  for (size_t i = 0; i < kBlobs; ++i) {
+    outputs.push_back(hashes[i].data());
+    inputs.push_back(blobs[i].data());
+    sizes.push_back(blobs[i].size());
+  }
+
+  for (auto _ : state) {
+    iroha::sha3_256(outputs.data(), inputs.data(), sizes.data(), kBlobs);
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kBlobs);
+  state.SetBytesProcessed(state.iterations() * kBlobs * state.range(0));
+}
+BENCHMARK(BM_Sha3AtOnce)->RangeMultiplier(4)->Range(64, 1 << 12);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,152 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Stateful validation of proposals on the WSV of a single node. A share of
+ * the accounts starts the proposal with a SetQuorum of its own, so that the
+ * signatures of its later transactions depend on a preceding transaction and
+ * are checked one by one, while the signatures of the rest are checked in
+ * advance on another connection. The share of such transactions is set by
+ * the conflict rate, and the rate of 100 is the validation without checks in
+ * advance, to compare the other rates with.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/storage.hpp"
+#include "ametsuchi/temporary_wsv.hpp"
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "benchmark/bm_utils.hpp"
+#include "framework/integration_framework/iroha_instance.hpp"
+#include "framework/integration_framework/test_irohad.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "logger/dummy_logger.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+#include "validation/impl/stateful_validator_impl.hpp"
+#include "validators/default_validator.hpp"
+
+using namespace benchmark::utils;
+using namespace common_constants;
+using shared_model::interface::types::PublicKeyHexStringView;
+
+namespace {
+  /// Number of accounts which create the transactions of a proposal
+  constexpr size_t kAccounts = 32;
+  const std::string kValidatedRole = "validated";
+
+  std::string accountName(size_t index) {
+    return "account" + std::to_string(index);
+  }
+
+  std::string accountId(size_t index) {
+    return accountName(index) + "@" + kDomain;
+  }
+}  // namespace
+
+/**
+ * Validates a proposal of the given size in every iteration
+ * @param state - range(0) is the proposal size, range(1) is the percentage of
+ * accounts whose transactions depend on a preceding one
+ */
+static void BM_StatefulValidation(benchmark::State &state) {
+  const auto proposal_size = static_cast<size_t>(state.range(0));
+  const auto conflicting_accounts =
+      static_cast<size_t>(state.range(1)) * kAccounts / 100;
+
+  integration_framework::IntegrationTestFramework itf(1);
+  itf.setInitialState(kAdminKeypair);
+
+  std::vector<shared_model::crypto::Keypair> keypairs;
+  auto accounts_tx =
+      TestUnsignedTransactionBuilder()
+          .creatorAccountId(kAdminId)
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .createRole(kValidatedRole,
+                      {shared_model::interface::permissions::Role::kSetQuorum,
+                       shared_model::interface::permissions::Role::kSetDetail});
+  for (size_t i = 0; i < kAccounts; ++i) {
+    keypairs.push_back(
+        shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair());
+    accounts_tx =
+        accounts_tx
+            .createAccount(accountName(i),
+                           kDomain,
+                           PublicKeyHexStringView{keypairs[i].publicKey()})
+            .appendRole(accountId(i), kValidatedRole);
+  }
+  itf.sendTx(accounts_tx.build().signAndAddSignature(kAdminKeypair).finish())
+      .skipProposal()
+      .skipBlock();
+
+  std::vector<shared_model::proto::Transaction> txs;
+  for (size_t i = 0; i < proposal_size; ++i) {
+    const auto account = i % kAccounts;
+    auto builder = TestUnsignedTransactionBuilder()
+                       .creatorAccountId(accountId(account))
+                       .createdTime(iroha::time::now() + i)
+                       .quorum(1);
+    if (i < kAccounts and account < conflicting_accounts) {
+      builder = builder.setAccountQuorum(accountId(account), 1);
+    } else {
+      builder = builder.setAccountDetail(
+          accountId(account), "key" + std::to_string(i), "value");
+    }
+    txs.push_back(
+        builder.build().signAndAddSignature(keypairs[account]).finish());
+  }
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(3)
+                      .transactions(txs)
+                      .build();
+
+  iroha::validation::StatefulValidatorImpl validator(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      std::make_shared<shared_model::interface::TransactionBatchParserImpl>(),
+      logger::getDummyLoggerPtr());
+  auto storage = itf.getIrohaInstance().getIrohaInstance()->getStorage();
+
+  size_t rejected = 0;
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::shared_ptr<iroha::ametsuchi::CommandExecutor> command_executor =
+        storage->createCommandExecutor().assumeValue();
+    auto temporary_wsv = storage->createTemporaryWsv(command_executor);
+    state.ResumeTiming();
+
+    auto result = validator.validate(proposal, *temporary_wsv);
+
+    state.PauseTiming();
+    rejected = result->rejected_transactions.size();
+    temporary_wsv.reset();
+    state.ResumeTiming();
+  }
+  if (rejected != 0) {
+    state.SkipWithError("Transactions are rejected");
+  }
+  state.SetItemsProcessed(state.iterations() * proposal_size);
+  itf.done();
+}
+
+static void validationArguments(benchmark::internal::Benchmark *b) {
+  for (auto proposal_size : {100, 1000}) {
+    for (auto conflict_rate : {0, 10, 50, 100}) {
+      b->Args({proposal_size, conflict_rate});
+    }
+  }
+}
+
+BENCHMARK(BM_StatefulValidation)
+    ->ArgNames({"proposal_size", "conflict_rate"})
+    ->Apply(validationArguments)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
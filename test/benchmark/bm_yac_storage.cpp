@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Insertion of votes into the YAC proposal storage, as it is done for every
+ * incoming state, at different cluster sizes. Each iteration inserts votes of
+ * all peers and then the same state again, as it is received with commit
+ * and reject rebroadcasts.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "backend/plain/signature.hpp"
+#include "consensus/yac/storage/yac_proposal_storage.hpp"
+#include "consensus/yac/supermajority_checker.hpp"
+#include "framework/test_logger.hpp"
+
+using namespace iroha::consensus::yac;
+
+namespace {
+  /**
+   * Make a vote of every peer
+   * @param peers - number of peers
+   * @param hashes - number of distinct block hashes the peers vote for
+   */
+  std::vector<VoteMessage> makeVotes(size_t peers, size_t hashes) {
+    std::vector<VoteMessage> votes;
+    for (size_t i = 0; i < peers; ++i) {
+      auto key = std::string(64, '0') + std::to_string(i);
+      key = key.substr(key.size() - 64);
+      VoteMessage vote;
+      vote.hash = YacHash(iroha::consensus::Round{1, 0},
+                          "proposal",
+                          "block" + std::to_string(i % hashes));
+      vote.signature = std::make_shared<shared_model::plain::Signature>(
+          shared_model::interface::types::SignedHexStringView{key + key},
+          shared_model::interface::types::PublicKeyHexStringView{key});
+      votes.push_back(std::move(vote));
+    }
+    return votes;
+  }
+
+  void insertVotes(benchmark::State &state, size_t hashes) {
+    const auto peers = static_cast<size_t>(state.range(0));
+    auto votes = makeVotes(peers, hashes);
+    auto log_manager = getTestLoggerManager(logger::LogLevel::kError)
+                           ->getChild("YacProposalStorage");
+    std::shared_ptr<SupermajorityChecker> supermajority_checker =
+        getSupermajorityChecker(ConsistencyModel::kBft);
+
+    for (auto _ : state) {
+      YacProposalStorage storage(iroha::consensus::Round{1, 0},
+                                 peers,
+                                 supermajority_checker,
+                                 log_manager);
+      storage.insert(votes);
+      benchmark::DoNotOptimize(storage.insert(votes));
+    }
+    state.SetItemsProcessed(state.iterations() * peers * 2);
+  }
+}  // namespace
+
+/// All peers vote for the same block, which ends with a commit
+static void BM_YacStorageCommit(benchmark::State &state) {
+  insertVotes(state, 1);
+}
+BENCHMARK(BM_YacStorageCommit)->Arg(4)->Arg(32)->Arg(128)->Arg(512);
+
+/// Peers vote for three different blocks, which ends with a reject
+static void BM_YacStorageReject(benchmark::State &state) {
+  insertVotes(state, 3);
+}
+BENCHMARK(BM_YacStorageReject)->Arg(4)->Arg(32)->Arg(128)->Arg(512);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load_generator/latency_report.hpp"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+namespace {
+  double toMilliseconds(iroha::load::LatencyReport::Duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  }
+
+  /// @param sorted - nonempty sorted latencies
+  iroha::load::LatencyReport::Duration percentile(
+      const std::vector<iroha::load::LatencyReport::Duration> &sorted,
+      double p) {
+    auto index = static_cast<size_t>(p / 100. * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+  }
+}  // namespace
+
+namespace iroha {
+  namespace load {
+
+    void LatencyReport::record(iroha::protocol::TxStatus status,
+                               Duration latency) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      latencies_[status].push_back(latency);
+    }
+
+    void LatencyReport::recordUnfinished() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++unfinished_;
+    }
+
+    void LatencyReport::print(std::ostream &os, Duration elapsed) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      os << fmt::format("{:<30} {:>8} {:>10} {:>10} {:>10} {:>10} {:>10}\n",
+                        "status",
+                        "count",
+                        "p50, ms",
+                        "p90, ms",
+                        "p99, ms",
+                        "p99.9, ms",
+                        "max, ms");
+      for (const auto &status_latencies : latencies_) {
+        auto sorted = status_latencies.second;
+        std::sort(sorted.begin(), sorted.end());
+        os << fmt::format(
+            "{:<30} {:>8} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f}\n",
+            iroha::protocol::TxStatus_Name(status_latencies.first),
+            sorted.size(),
+            toMilliseconds(percentile(sorted, 50)),
+            toMilliseconds(percentile(sorted, 90)),
+            toMilliseconds(percentile(sorted, 99)),
+            toMilliseconds(percentile(sorted, 99.9)),
+            toMilliseconds(sorted.back()));
+      }
+
+      auto committed = latencies_.find(iroha::protocol::TxStatus::COMMITTED);
+      auto committed_count =
+          committed == latencies_.end() ? 0 : committed->second.size();
+      os << fmt::format(
+          "committed {} transactions in {:.1f} s, {:.1f} tx/s, {} without a "
+          "final status\n",
+          committed_count,
+          toMilliseconds(elapsed) / 1000.,
+          committed_count / (toMilliseconds(elapsed) / 1000.),
+          unfinished_);
+    }
+
+  }  // namespace load
+}  // namespace iroha
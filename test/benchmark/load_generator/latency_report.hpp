@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LOAD_GENERATOR_LATENCY_REPORT_HPP
+#define IROHA_LOAD_GENERATOR_LATENCY_REPORT_HPP
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#include "endpoint.pb.h"
+
+namespace iroha {
+  namespace load {
+
+    /**
+     * Latencies from sending a transaction to each of its statuses, and the
+     * number of transactions which have not reached a final status
+     */
+    class LatencyReport {
+     public:
+      using Duration = std::chrono::steady_clock::duration;
+
+      /// Record the time it took the transaction to reach the status
+      void record(iroha::protocol::TxStatus status, Duration latency);
+
+      /// Record the transaction whose stream closed before a final status
+      void recordUnfinished();
+
+      /**
+       * Print the percentiles of latencies per status and the commit
+       * throughput
+       * @param elapsed - duration of the whole run
+       */
+      void print(std::ostream &os, Duration elapsed) const;
+
+     private:
+      mutable std::mutex mutex_;
+      std::map<iroha::protocol::TxStatus, std::vector<Duration>> latencies_;
+      size_t unfinished_ = 0;
+    };
+
+  }  // namespace load
+}  // namespace iroha
+
+#endif  // IROHA_LOAD_GENERATOR_LATENCY_REPORT_HPP
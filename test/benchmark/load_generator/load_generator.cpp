@@ -0,0 +1,258 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Load generator for Torii. Pre-generates and pre-signs a corpus of
+ * transactions, replays it either with a fixed number of clients, each of
+ * which waits for the final status of its transaction before sending the next
+ * one (closed loop), or at a fixed rate regardless of the responses (open
+ * loop), and prints percentiles of latencies from sending a transaction to
+ * each of its statuses.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <ciso646>
+#include <future>
+#include <iostream>
+#include <thread>
+
+#include <gflags/gflags.h>
+#include <grpc++/grpc++.h>
+#include "crypto/keys_manager_impl.hpp"
+#include "datetime/time.hpp"
+#include "load_generator/latency_report.hpp"
+#include "load_generator/status_tracker.hpp"
+#include "load_generator/tx_corpus.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+#include "torii/command_client.hpp"
+
+DEFINE_string(torii, "127.0.0.1:50051", "Torii address of the node");
+DEFINE_string(account_id, "admin@test", "Creator of the transactions");
+DEFINE_string(keypair_path,
+              ".",
+              "Directory with the .pub and .priv files of the creator");
+DEFINE_string(destination,
+              "loadgen@test",
+              "Destination account of the transfers");
+DEFINE_string(asset_id, "coin#test", "Asset of the transfers");
+DEFINE_string(mix,
+              "transfer",
+              "Comma separated kinds of generated transactions: transfer, "
+              "multisig, detail, engine");
+DEFINE_string(engine_input,
+              "600a600c600039600a6000f3602a60005260206000f3",
+              "Hex bytecode of the contract deployed by engine calls");
+DEFINE_uint64(transactions, 10000, "Number of transactions in the corpus");
+DEFINE_uint64(batch_size,
+              1,
+              "Number of transactions in an atomic batch, 1 to send single "
+              "transactions");
+DEFINE_uint64(clients,
+              16,
+              "Number of concurrent clients in the closed loop mode, or of "
+              "sending threads in the open loop mode");
+DEFINE_double(rate,
+              0,
+              "Batches per second sent in the open loop mode, 0 for the "
+              "closed loop mode");
+DEFINE_bool(setup,
+            false,
+            "Before the replay, create the destination account, add the asset "
+            "to the creator and add the multisig signatory to the creator");
+
+using Clock = iroha::load::StatusTracker::Clock;
+
+namespace {
+  /// Stub without the deadline of the default client, as status streams may
+  /// outlive it under load
+  auto makeStub() {
+    return iroha::protocol::CommandService_v1::NewStub(
+        grpc::CreateChannel(FLAGS_torii, grpc::InsecureChannelCredentials()));
+  }
+
+  /**
+   * Send the setup transactions one by one
+   * @return true if all of them are committed
+   */
+  bool setup(const torii::CommandSyncClient &client,
+             const shared_model::crypto::Keypair &keypair,
+             const shared_model::crypto::Keypair &multisig_keypair,
+             const std::vector<iroha::load::TxKind> &kinds,
+             const logger::LoggerPtr &log) {
+    using shared_model::interface::types::PublicKeyHexStringView;
+    auto builder = [] {
+      return TestUnsignedTransactionBuilder()
+          .createdTime(iroha::time::now())
+          .creatorAccountId(FLAGS_account_id)
+          .quorum(1);
+    };
+    auto separator = FLAGS_destination.find('@');
+    auto destination_keypair =
+        shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+    std::vector<shared_model::proto::Transaction> txs{
+        builder()
+            .createAccount(
+                FLAGS_destination.substr(0, separator),
+                FLAGS_destination.substr(separator + 1),
+                PublicKeyHexStringView{destination_keypair.publicKey()})
+            .build()
+            .signAndAddSignature(keypair)
+            .finish(),
+        builder()
+            .addAssetQuantity(FLAGS_asset_id, "1000000")
+            .build()
+            .signAndAddSignature(keypair)
+            .finish()};
+    if (std::find(kinds.begin(), kinds.end(), iroha::load::TxKind::kMultisig)
+        != kinds.end()) {
+      txs.push_back(builder()
+                        .addSignatory(FLAGS_account_id,
+                                      PublicKeyHexStringView{
+                                          multisig_keypair.publicKey()})
+                        .build()
+                        .signAndAddSignature(keypair)
+                        .finish());
+    }
+
+    bool committed = true;
+    for (const auto &tx : txs) {
+      client.Torii(tx.getTransport());
+      iroha::protocol::TxStatusRequest request;
+      request.set_tx_hash(tx.hash().hex());
+      std::vector<iroha::protocol::ToriiResponse> statuses;
+      client.StatusStream(request, statuses);
+      if (statuses.empty()
+          or statuses.back().tx_status()
+              != iroha::protocol::TxStatus::COMMITTED) {
+        // e.g. the destination account exists after a previous run
+        log->warn("Setup transaction {} is not committed: {}",
+                  tx.hash().hex(),
+                  statuses.empty() ? "" : statuses.back().err_or_cmd_name());
+        committed = false;
+      }
+    }
+    return committed;
+  }
+
+  grpc::Status send(const torii::CommandSyncClient &client,
+                    const iroha::load::CorpusEntry &entry) {
+    return entry.txs.transactions_size() == 1
+        ? client.Torii(entry.txs.transactions(0))
+        : client.ListTorii(entry.txs);
+  }
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  auto log_manager = std::make_shared<logger::LoggerManagerTree>(
+      logger::LoggerConfig{logger::LogLevel::kInfo,
+                           logger::getDefaultLogPatterns()});
+  auto log = log_manager->getChild("LoadGenerator")->getLogger();
+
+  auto kinds = iroha::load::parseTxKinds(FLAGS_mix);
+  if (kinds.empty() or FLAGS_batch_size == 0) {
+    log->error("Invalid transaction mix '{}' or batch size {}",
+               FLAGS_mix,
+               FLAGS_batch_size);
+    return EXIT_FAILURE;
+  }
+
+  auto keys = iroha::KeysManagerImpl(
+                  FLAGS_account_id,
+                  FLAGS_keypair_path,
+                  log_manager->getChild("KeysManager")->getLogger())
+                  .loadKeys(boost::none);
+  if (auto e = iroha::expected::resultToOptionalError(keys)) {
+    log->error("Failed to load the keypair: {}", e.value());
+    return EXIT_FAILURE;
+  }
+  auto keypair = std::move(keys).assumeValue();
+  auto multisig_keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+
+  torii::CommandSyncClient client(
+      makeStub(), log_manager->getChild("CommandClient")->getLogger());
+  if (FLAGS_setup
+      and not setup(client, keypair, multisig_keypair, kinds, log)) {
+    log->warn("Setup is incomplete, the replay may be rejected");
+  }
+
+  log->info("Signing {} transactions", FLAGS_transactions);
+  auto corpus = iroha::load::generateCorpus(
+      iroha::load::CorpusConfig{FLAGS_account_id,
+                                keypair,
+                                multisig_keypair,
+                                FLAGS_destination,
+                                FLAGS_asset_id,
+                                FLAGS_engine_input,
+                                kinds,
+                                FLAGS_batch_size,
+                                FLAGS_transactions,
+                                std::thread::hardware_concurrency()});
+
+  iroha::load::LatencyReport report;
+  iroha::load::StatusTracker tracker(makeStub(), report);
+  std::atomic<size_t> next_entry{0};
+  const bool open_loop = FLAGS_rate > 0;
+  const auto start = Clock::now();
+
+  log->info("Replaying {} requests in the {} loop mode",
+            corpus.size(),
+            open_loop ? "open" : "closed");
+  std::vector<std::thread> clients;
+  for (size_t c = 0; c < FLAGS_clients; ++c) {
+    clients.emplace_back([&] {
+      for (size_t i = next_entry++; i < corpus.size(); i = next_entry++) {
+        const auto &entry = corpus[i];
+        auto sent_time = Clock::now();
+        if (open_loop) {
+          // latencies are measured from the scheduled time, so that a
+          // stalled sender does not hide the delay
+          sent_time = start
+              + std::chrono::duration_cast<Clock::duration>(
+                          std::chrono::duration<double>(i / FLAGS_rate));
+          std::this_thread::sleep_until(sent_time);
+        }
+
+        auto status = send(client, entry);
+        if (not status.ok()) {
+          log->warn("Failed to send request {}: {}",
+                    i,
+                    status.error_message());
+          for (size_t tx = 0; tx < entry.hashes.size(); ++tx) {
+            report.recordUnfinished();
+          }
+          continue;
+        }
+
+        auto remaining =
+            std::make_shared<std::atomic<size_t>>(entry.hashes.size());
+        auto done = std::make_shared<std::promise<void>>();
+        for (const auto &hash : entry.hashes) {
+          tracker.track(hash, sent_time, [remaining, done] {
+            if (--*remaining == 0) {
+              done->set_value();
+            }
+          });
+        }
+        if (not open_loop) {
+          done->get_future().wait();
+        }
+      }
+    });
+  }
+  for (auto &thread : clients) {
+    thread.join();
+  }
+  tracker.waitAll();
+
+  report.print(std::cout, Clock::now() - start);
+  return EXIT_SUCCESS;
+}
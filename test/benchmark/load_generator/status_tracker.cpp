@@ -0,0 +1,118 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load_generator/status_tracker.hpp"
+
+#include <ciso646>
+#include <set>
+
+namespace {
+  bool isFinal(iroha::protocol::TxStatus status) {
+    switch (status) {
+      case iroha::protocol::TxStatus::STATELESS_VALIDATION_FAILED:
+      case iroha::protocol::TxStatus::REJECTED:
+      case iroha::protocol::TxStatus::COMMITTED:
+      case iroha::protocol::TxStatus::MST_EXPIRED:
+        return true;
+      default:
+        return false;
+    }
+  }
+}  // namespace
+
+namespace iroha {
+  namespace load {
+
+    /// Status stream of a single transaction
+    struct StatusTracker::Call {
+      enum class State { kStarting, kReading, kFinishing };
+
+      State state = State::kStarting;
+      grpc::ClientContext context;
+      iroha::protocol::TxStatusRequest request;
+      iroha::protocol::ToriiResponse response;
+      grpc::Status status;
+      std::unique_ptr<
+          grpc::ClientAsyncReaderInterface<iroha::protocol::ToriiResponse>>
+          reader;
+      Clock::time_point sent_time;
+      std::function<void()> on_final;
+      /// statuses already recorded, a stream may repeat them
+      std::set<int> recorded;
+      bool final = false;
+    };
+
+    StatusTracker::StatusTracker(
+        std::unique_ptr<iroha::protocol::CommandService_v1::StubInterface> stub,
+        LatencyReport &report)
+        : stub_(std::move(stub)), report_(report), thread_([this] { run(); }) {}
+
+    StatusTracker::~StatusTracker() {
+      queue_.Shutdown();
+      thread_.join();
+    }
+
+    void StatusTracker::track(std::string tx_hash,
+                              Clock::time_point sent_time,
+                              std::function<void()> on_final) {
+      {
+        std::lock_guard<std::mutex> lock(in_flight_mutex_);
+        ++in_flight_;
+      }
+      auto call = new Call;
+      call->request.set_tx_hash(std::move(tx_hash));
+      call->sent_time = sent_time;
+      call->on_final = std::move(on_final);
+      call->reader = stub_->PrepareAsyncStatusStream(
+          &call->context, call->request, &queue_);
+      call->reader->StartCall(call);
+    }
+
+    void StatusTracker::waitAll() {
+      std::unique_lock<std::mutex> lock(in_flight_mutex_);
+      in_flight_cv_.wait(lock, [this] { return in_flight_ == 0; });
+    }
+
+    void StatusTracker::run() {
+      void *tag;
+      bool ok;
+      while (queue_.Next(&tag, &ok)) {
+        auto call = static_cast<Call *>(tag);
+        switch (call->state) {
+          case Call::State::kStarting:
+          case Call::State::kReading:
+            if (call->state == Call::State::kReading and ok) {
+              auto status = call->response.tx_status();
+              if (call->recorded.insert(status).second) {
+                report_.record(status, Clock::now() - call->sent_time);
+              }
+              call->final = call->final or isFinal(status);
+            }
+            if (ok) {
+              call->state = Call::State::kReading;
+              call->reader->Read(&call->response, call);
+            } else {
+              call->state = Call::State::kFinishing;
+              call->reader->Finish(&call->status, call);
+            }
+            break;
+          case Call::State::kFinishing:
+            if (not call->final) {
+              report_.recordUnfinished();
+            }
+            call->on_final();
+            delete call;
+            {
+              std::lock_guard<std::mutex> lock(in_flight_mutex_);
+              --in_flight_;
+            }
+            in_flight_cv_.notify_all();
+            break;
+        }
+      }
+    }
+
+  }  // namespace load
+}  // namespace iroha
@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LOAD_GENERATOR_STATUS_TRACKER_HPP
+#define IROHA_LOAD_GENERATOR_STATUS_TRACKER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <grpc++/grpc++.h>
+#include "endpoint.grpc.pb.h"
+#include "load_generator/latency_report.hpp"
+
+namespace iroha {
+  namespace load {
+
+    /**
+     * Follows the status streams of the sent transactions over a single
+     * completion queue, so that thousands of transactions in flight do not
+     * need a thread each, and records the time of every status transition
+     */
+    class StatusTracker {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * @param stub - command service of the node
+       * @param report - where the latencies are recorded
+       */
+      StatusTracker(
+          std::unique_ptr<iroha::protocol::CommandService_v1::StubInterface>
+              stub,
+          LatencyReport &report);
+
+      ~StatusTracker();
+
+      /**
+       * Start following the transaction status
+       * @param tx_hash - hex hash of the transaction
+       * @param sent_time - time the latencies are measured from
+       * @param on_final - called from the tracker thread once the final
+       * status is received or the stream is closed
+       */
+      void track(std::string tx_hash,
+                 Clock::time_point sent_time,
+                 std::function<void()> on_final);
+
+      /// Wait until every tracked transaction has got its final status
+      void waitAll();
+
+     private:
+      struct Call;
+
+      void run();
+
+      std::unique_ptr<iroha::protocol::CommandService_v1::StubInterface> stub_;
+      LatencyReport &report_;
+      grpc::CompletionQueue queue_;
+      std::mutex in_flight_mutex_;
+      std::condition_variable in_flight_cv_;
+      size_t in_flight_ = 0;
+      std::thread thread_;
+    };
+
+  }  // namespace load
+}  // namespace iroha
+
+#endif  // IROHA_LOAD_GENERATOR_STATUS_TRACKER_HPP
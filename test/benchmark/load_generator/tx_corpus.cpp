@@ -0,0 +1,145 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load_generator/tx_corpus.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using shared_model::interface::types::EvmCodeHexStringView;
+
+namespace {
+  /**
+   * Prepare the builder of the transaction with the given index in the corpus
+   * @param created_time - unique creation time of the transaction
+   */
+  auto makeBuilder(const iroha::load::CorpusConfig &config,
+                   size_t index,
+                   shared_model::interface::types::TimestampType created_time) {
+    using iroha::load::TxKind;
+    auto kind = config.kinds[index % config.kinds.size()];
+    auto builder = TestUnsignedTransactionBuilder()
+                       .createdTime(created_time)
+                       .creatorAccountId(config.creator_account_id)
+                       .quorum(kind == TxKind::kMultisig ? 2 : 1);
+    switch (kind) {
+      case TxKind::kTransfer:
+      case TxKind::kMultisig:
+        return builder.transferAsset(config.creator_account_id,
+                                     config.destination_account_id,
+                                     config.asset_id,
+                                     "",
+                                     "0.01");
+      case TxKind::kDetail:
+        return builder.setAccountDetail(config.creator_account_id,
+                                        "key" + std::to_string(index),
+                                        std::to_string(created_time));
+      case TxKind::kEngineCall:
+        return builder.callEngine(config.creator_account_id,
+                                  std::nullopt,
+                                  EvmCodeHexStringView{config.engine_input});
+    }
+    return builder;
+  }
+
+  void sign(const iroha::load::CorpusConfig &config,
+            size_t index,
+            shared_model::proto::UnsignedWrapper<shared_model::proto::Transaction>
+                &tx) {
+    tx.signAndAddSignature(config.keypair);
+    if (config.kinds[index % config.kinds.size()]
+        == iroha::load::TxKind::kMultisig) {
+      tx.signAndAddSignature(config.multisig_keypair);
+    }
+  }
+
+  iroha::load::CorpusEntry makeEntry(
+      const iroha::load::CorpusConfig &config,
+      size_t first_index,
+      shared_model::interface::types::TimestampType now) {
+    iroha::load::CorpusEntry entry;
+    // creation times go back from now, so that the whole corpus stays
+    // acceptable for the stateless validation during the replay
+    auto created_time = [&](size_t index) { return now - index; };
+
+    if (config.batch_size == 1) {
+      auto tx = makeBuilder(config, first_index, created_time(first_index))
+                    .build();
+      sign(config, first_index, tx);
+      auto signed_tx = tx.finish();
+      entry.hashes.push_back(signed_tx.hash().hex());
+      *entry.txs.add_transactions() = signed_tx.getTransport();
+      return entry;
+    }
+
+    std::vector<shared_model::interface::types::HashType> reduced_hashes;
+    for (size_t i = first_index; i < first_index + config.batch_size; ++i) {
+      reduced_hashes.push_back(
+          makeBuilder(config, i, created_time(i)).build().reducedHash());
+    }
+    for (size_t i = first_index; i < first_index + config.batch_size; ++i) {
+      auto tx = makeBuilder(config, i, created_time(i))
+                    .batchMeta(shared_model::interface::types::BatchType::ATOMIC,
+                               reduced_hashes)
+                    .build();
+      sign(config, i, tx);
+      auto signed_tx = tx.finish();
+      entry.hashes.push_back(signed_tx.hash().hex());
+      *entry.txs.add_transactions() = signed_tx.getTransport();
+    }
+    return entry;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace load {
+
+    std::vector<TxKind> parseTxKinds(const std::string &kinds) {
+      static const std::unordered_map<std::string, TxKind> kKinds{
+          {"transfer", TxKind::kTransfer},
+          {"multisig", TxKind::kMultisig},
+          {"detail", TxKind::kDetail},
+          {"engine", TxKind::kEngineCall}};
+
+      std::vector<std::string> names;
+      boost::split(names, kinds, boost::is_any_of(","));
+      std::vector<TxKind> result;
+      for (const auto &name : names) {
+        auto it = kKinds.find(name);
+        if (it == kKinds.end()) {
+          return {};
+        }
+        result.push_back(it->second);
+      }
+      return result;
+    }
+
+    std::vector<CorpusEntry> generateCorpus(const CorpusConfig &config) {
+      const auto now = iroha::time::now();
+      std::vector<CorpusEntry> corpus(config.transactions / config.batch_size);
+
+      std::vector<std::thread> threads;
+      const auto thread_count = std::max<size_t>(config.threads, 1);
+      for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+          for (size_t i = t; i < corpus.size(); i += thread_count) {
+            corpus[i] = makeEntry(config, i * config.batch_size, now);
+          }
+        });
+      }
+      for (auto &thread : threads) {
+        thread.join();
+      }
+      return corpus;
+    }
+
+  }  // namespace load
+}  // namespace iroha
@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LOAD_GENERATOR_TX_CORPUS_HPP
+#define IROHA_LOAD_GENERATOR_TX_CORPUS_HPP
+
+#include <string>
+#include <vector>
+
+#include "cryptography/keypair.hpp"
+#include "endpoint.pb.h"
+
+namespace iroha {
+  namespace load {
+
+    /// Kinds of transactions in the corpus
+    enum class TxKind {
+      /// transfer of the asset to the destination account
+      kTransfer,
+      /// transfer signed by two signatories of the creator
+      kMultisig,
+      /// write of a unique account detail of the creator
+      kDetail,
+      /// deployment of the contract to the EVM
+      kEngineCall
+    };
+
+    /**
+     * Parse comma separated list of transaction kinds
+     * @param kinds - e.g. "transfer,multisig,detail,engine"
+     * @return parsed kinds, empty if any of them is unknown
+     */
+    std::vector<TxKind> parseTxKinds(const std::string &kinds);
+
+    struct CorpusConfig {
+      std::string creator_account_id;
+      shared_model::crypto::Keypair keypair;
+      /// second signatory of the creator, used by multisig transactions
+      shared_model::crypto::Keypair multisig_keypair;
+      std::string destination_account_id;
+      std::string asset_id;
+      /// hex bytecode of the contract deployed by engine calls
+      std::string engine_input;
+      /// transactions are generated round robin over the kinds
+      std::vector<TxKind> kinds;
+      /// number of transactions in an atomic batch, 1 for single transactions
+      size_t batch_size;
+      /// total number of transactions
+      size_t transactions;
+      /// number of threads signing the transactions
+      size_t threads;
+    };
+
+    /// Signed transactions sent in a single request
+    struct CorpusEntry {
+      iroha::protocol::TxList txs;
+      /// hex hashes of the transactions, for status requests
+      std::vector<std::string> hashes;
+    };
+
+    /**
+     * Generate and sign the transactions in advance, so that the replay costs
+     * only the transport
+     * @return entries of batch_size transactions each
+     */
+    std::vector<CorpusEntry> generateCorpus(const CorpusConfig &config);
+
+  }  // namespace load
+}  // namespace iroha
+
+#endif  // IROHA_LOAD_GENERATOR_TX_CORPUS_HPP
@@ -84,7 +84,7 @@ Result<void, TxExecutionError> ExecutorItf::executeTransaction(
 
 iroha::ametsuchi::QueryExecutorResult ExecutorItf::executeQuery(
     const shared_model::interface::Query &query) const {
-  return query_executor_->execute(query);
+  return query_executor_->execute(query, 0);
 }
 
 const std::unique_ptr<shared_model::interface::MockCommandFactory>
@@ -81,6 +81,10 @@ namespace integration_framework {
       return pcs;
     }
 
+    auto &getSimulator() {
+      return simulator;
+    }
+
     auto &getCryptoSigner() {
       return crypto_signer_;
     }
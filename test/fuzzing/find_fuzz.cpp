@@ -52,7 +52,8 @@ struct QueryFixture {
                                      ErrorQueryType::kStatefulFailed,
                                  "I'm a teapot",
                                  418,
-                                 shared_model::crypto::Hash{"BADD00DE"})
+                                 shared_model::crypto::Hash{"BADD00DE"},
+                                 0)
                              .release()));
           return query_executor;
         });
@@ -239,6 +239,19 @@ TEST_P(GetAccountAssetsBasicTest, NonexistentStartTx) {
       response, error_codes::kInvalidPagination);
 }
 
+/**
+ * @given account with all related permissions and 10 assets
+ * @when more quantity of already owned assets is added to the account
+ * @then the total number of assets stays the same
+ */
+TEST_P(GetAccountAssetsBasicTest, TotalNumberAfterRepeatedAdd) {
+  ASSERT_NO_FATAL_FAILURE(prepareState(10));
+  for (size_t i = 0; i < 10; ++i) {
+    addAsset(kUserId, makeAssetId(i), makeAssetQuantity(0));
+  }
+  queryPageAndValidateResponse(3, 5);
+}
+
 INSTANTIATE_TEST_SUITE_P(Base,
                          GetAccountAssetsBasicTest,
                          executor_testing::getExecutorTestParams(),
@@ -218,6 +218,45 @@ TEST_F(AmetsuchiTest, PeerTest) {
   ASSERT_EQ(peers->at(0)->pubkey(), fake_pubkey);
 }
 
+/**
+ * @given storage with two peers added by the first block
+ * @when a block without peer commands and then a block which removes one of
+ * the peers are committed
+ * @then the peers of the ledger state are shared after the second block
+ * @and the ledger state has the remaining peer after the third block
+ */
+TEST_F(AmetsuchiTest, LedgerPeersAreSharedUntilPeersChange) {
+  auto pubkey2{"2"_hex_pubkey};
+  auto block1 = createBlock({TestTransactionBuilder()
+                                 .addPeer("192.168.9.1:50051", fake_pubkey)
+                                 .addPeer("192.168.9.2:50051", pubkey2)
+                                 .build()},
+                            1,
+                            fake_hash);
+  apply(storage, block1);
+  auto peers = storage->getLedgerState().value()->ledger_peers;
+  ASSERT_EQ(peers.size(), 2);
+
+  auto block2 = createBlock({TestTransactionBuilder()
+                                 .createRole("role", {Role::kAddPeer})
+                                 .build()},
+                            2,
+                            block1->hash());
+  apply(storage, block2);
+  auto ledger_state = storage->getLedgerState().value();
+  EXPECT_EQ(ledger_state->ledger_peers, peers);
+  EXPECT_EQ(ledger_state->top_block_info.height, 2);
+
+  auto block3 =
+      createBlock({TestTransactionBuilder().removePeer(fake_pubkey).build()},
+                  3,
+                  block2->hash());
+  apply(storage, block3);
+  ledger_state = storage->getLedgerState().value();
+  ASSERT_EQ(ledger_state->ledger_peers.size(), 1);
+  EXPECT_EQ(ledger_state->ledger_peers.front()->pubkey(), pubkey2);
+}
+
 TEST_F(AmetsuchiTest, AddSignatoryTest) {
   ASSERT_TRUE(storage);
   auto wsv = storage->getWsvQuery();
@@ -445,6 +484,82 @@ TEST_F(AmetsuchiTest, TestingStorageWhenCommitBlock) {
   wrapper.unsubscribe();
 }
 
+/**
+ * @given mutable storage with two applied blocks
+ * @when it is committed
+ * @then both blocks are written to block storage and emitted in order
+ * @and the ledger state is of the last block
+ */
+TEST_F(AmetsuchiTest, TestingStorageWhenCommitSeveralBlocks) {
+  ASSERT_TRUE(storage);
+
+  auto block1 = createBlock({getGenesisTx()}, 1, fake_hash);
+  auto block2 = createBlock({createAddAsset("1.0")}, 2, block1->hash());
+
+  std::vector<std::shared_ptr<const shared_model::interface::Block>> committed;
+  auto subscription = storage->on_commit().subscribe(
+      [&committed](const auto &block) { committed.push_back(block); });
+
+  auto mutable_storage = createMutableStorage();
+  ASSERT_TRUE(mutable_storage->apply(block1));
+  ASSERT_TRUE(mutable_storage->apply(block2));
+
+  auto ledger_state = val(storage->commit(std::move(mutable_storage)));
+  ASSERT_TRUE(ledger_state);
+  EXPECT_EQ(ledger_state->value->top_block_info.height, 2);
+  EXPECT_EQ(ledger_state->value->top_block_info.top_hash, block2->hash());
+
+  EXPECT_EQ(storage->getBlockQuery()->getTopBlockHeight(), 2);
+  ASSERT_EQ(committed.size(), 2);
+  EXPECT_EQ(*committed[0], *block1);
+  EXPECT_EQ(*committed[1], *block2);
+  subscription.unsubscribe();
+}
+
+/**
+ * @given block storage which already has another block at the height of the
+ * next block
+ * @when the next block is committed
+ * @then the commit fails after WSV is committed, and the block is not emitted
+ * @and the following commits are refused without changing WSV
+ */
+TEST_F(AmetsuchiTest, CommitFailsWhenBlockStorageIsBehindWsv) {
+  auto block1 = createBlock({getGenesisTx()}, 1, fake_hash);
+  apply(storage, block1);
+
+  auto block2 = createBlock({createAddAsset("1.0")}, 2, block1->hash());
+  ASSERT_TRUE(block_storage_->insert(
+      createBlock({createAddAsset("2.0")}, 2, block1->hash())));
+
+  std::vector<std::shared_ptr<const shared_model::interface::Block>> committed;
+  auto subscription = storage->on_commit().subscribe(
+      [&committed](const auto &block) { committed.push_back(block); });
+
+  auto mutable_storage = createMutableStorage();
+  ASSERT_TRUE(mutable_storage->apply(block2));
+  auto error = err(storage->commit(std::move(mutable_storage)));
+  ASSERT_TRUE(error);
+  EXPECT_THAT(error->error,
+              ::testing::HasSubstr("Block storage is behind WSV"));
+  EXPECT_TRUE(committed.empty());
+  PostgresWsvQuery wsv_query{*sql, getTestLogger("WsvQuery")};
+  auto top_block_info =
+      iroha::expected::resultToOptionalValue(wsv_query.getTopBlockInfo());
+  ASSERT_TRUE(top_block_info);
+  EXPECT_EQ(top_block_info->height, 2);
+
+  auto block3 = createBlock({createAddAsset("3.0")}, 3, block2->hash());
+  mutable_storage = createMutableStorage();
+  ASSERT_TRUE(mutable_storage->apply(block3));
+  EXPECT_TRUE(err(storage->commit(std::move(mutable_storage))));
+  top_block_info =
+      iroha::expected::resultToOptionalValue(wsv_query.getTopBlockInfo());
+  ASSERT_TRUE(top_block_info);
+  EXPECT_EQ(top_block_info->height, 2);
+  EXPECT_TRUE(committed.empty());
+  subscription.unsubscribe();
+}
+
 /**
  * @given empty WSV and a genesis block in block storage
  * @when WSV is restored from block storage
@@ -818,6 +933,30 @@ TEST_F(PreparedBlockTest, CommitPreparedFailsAfterCommit) {
   validateAccountAsset(sql_query, kUserId, kAssetId, resultingBalance);
 }
 
+/**
+ * @given temporary WSV
+ * @when signatures of a correctly and of a wrongly signed transaction are
+ * checked in advance
+ * @then the correctly signed transaction is applied
+ * @and the wrongly signed one fails signatures validation
+ */
+TEST_F(PreparedBlockTest, PrevalidatedSignatures) {
+  auto wrongly_signed_tx = shared_model::proto::TransactionBuilder()
+                               .creatorAccountId(kUserId)
+                               .createdTime(iroha::time::now())
+                               .quorum(1)
+                               .addAssetQuantity(kAssetId, "1.00")
+                               .build()
+                               .signAndAddSignature(kSameDomainUserKeypair)
+                               .finish();
+  temp_wsv->prevalidateSignatures({*initial_tx, wrongly_signed_tx});
+
+  ASSERT_TRUE(val(temp_wsv->apply(*initial_tx)));
+  auto error = err(temp_wsv->apply(wrongly_signed_tx));
+  ASSERT_TRUE(error);
+  EXPECT_EQ(error->error.error_code, 2u);
+}
+
 /**
  * @given Storage with prepared state
  * @when another temporary wsv is created and transaction is applied
@@ -0,0 +1,149 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/background_block_indexer.hpp"
+
+#include <gtest/gtest.h>
+#include <soci/soci.h>
+#include <rxcpp/rx-lite.hpp>
+#include "ametsuchi/impl/in_memory_block_storage.hpp"
+#include "ametsuchi/impl/indexed_height.hpp"
+#include "backend/protobuf/block.hpp"
+#include "datetime/time.hpp"
+#include "framework/test_db_manager.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+using iroha::integration_framework::TestDbManager;
+using shared_model::interface::types::HeightType;
+
+class BackgroundBlockIndexerTest : public ::testing::Test {
+ public:
+  /// Put a block with a transaction of the creator to the block storage
+  std::shared_ptr<const shared_model::interface::Block> storeBlock(
+      HeightType height, const std::string &creator) {
+    std::vector<shared_model::proto::Transaction> txs;
+    txs.push_back(TestTransactionBuilder()
+                      .creatorAccountId(creator)
+                      .createdTime(iroha::time::now() + height)
+                      .build());
+    auto block = std::make_shared<shared_model::proto::Block>(
+        TestBlockBuilder().height(height).transactions(txs).build());
+    block_store_->insert(block);
+    return block;
+  }
+
+  /// @return heights of the transactions indexed for the creator
+  std::vector<HeightType> indexedHeights(const std::string &creator) {
+    std::vector<HeightType> heights(10);
+    *sql_ << "SELECT height FROM tx_positions WHERE creator_id = :creator "
+             "ORDER BY height",
+        soci::into(heights), soci::use(creator);
+    return heights;
+  }
+
+  std::unique_ptr<BackgroundBlockIndexer> makeIndexer(
+      HeightType committed_height) {
+    return std::make_unique<BackgroundBlockIndexer>(
+        test_db_manager_->getSession(),
+        block_store_,
+        indexed_height_,
+        committed_blocks_.get_observable(),
+        committed_height,
+        getTestLogger("BackgroundBlockIndexer"));
+  }
+
+  const std::string kCreator = "user@domain";
+
+  std::unique_ptr<TestDbManager> test_db_manager_{
+      TestDbManager::createWithRandomDbName(
+          2, getTestLoggerManager()->getChild("TestDbManager"))
+          .assumeValue()};
+  std::unique_ptr<soci::session> sql_{test_db_manager_->getSession()};
+  std::shared_ptr<InMemoryBlockStorage> block_store_ =
+      std::make_shared<InMemoryBlockStorage>();
+  std::shared_ptr<IndexedHeight> indexed_height_ =
+      std::make_shared<IndexedHeight>();
+  rxcpp::subjects::subject<
+      std::shared_ptr<const shared_model::interface::Block>>
+      committed_blocks_;
+};
+
+/**
+ * @given a running indexer without indexed blocks
+ * @when two blocks are committed
+ * @then their transaction positions are written in background
+ * @and the indexed height reaches the committed one
+ */
+TEST_F(BackgroundBlockIndexerTest, IndexesCommittedBlocks) {
+  auto block1 = storeBlock(1, kCreator);
+  auto block2 = storeBlock(2, kCreator);
+  auto indexer = makeIndexer(0);
+
+  committed_blocks_.get_subscriber().on_next(block1);
+  committed_blocks_.get_subscriber().on_next(block2);
+
+  ASSERT_TRUE(indexed_height_->waitIndexed(10s));
+  EXPECT_EQ(indexed_height_->getCommitted(), 2);
+  EXPECT_EQ(indexed_height_->getIndexed(), 2);
+  EXPECT_EQ(indexedHeights(kCreator), (std::vector<HeightType>{1, 2}));
+}
+
+/**
+ * @given blocks committed while no indexer was running
+ * @when the indexer is started at their height
+ * @then it resumes from the indexed height and writes the missing positions
+ */
+TEST_F(BackgroundBlockIndexerTest, ResumesFromIndexedHeight) {
+  storeBlock(1, kCreator);
+  storeBlock(2, kCreator);
+  ASSERT_TRUE(BackgroundBlockIndexer::indexMissing(
+      *sql_, *block_store_, 1, getTestLogger("BackgroundBlockIndexer")));
+
+  auto indexer = makeIndexer(2);
+
+  ASSERT_TRUE(indexed_height_->waitIndexed(10s));
+  EXPECT_EQ(indexed_height_->getIndexed(), 2);
+  EXPECT_EQ(indexedHeights(kCreator), (std::vector<HeightType>{1, 2}));
+}
+
+/**
+ * @given blocks which are partially indexed
+ * @when the missing positions are indexed up to the committed height, twice
+ * @then the positions of the rest of the blocks are written once
+ */
+TEST_F(BackgroundBlockIndexerTest, IndexMissingFillsGap) {
+  storeBlock(1, kCreator);
+  storeBlock(2, kCreator);
+  storeBlock(3, kCreator);
+  auto log = getTestLogger("BackgroundBlockIndexer");
+  ASSERT_TRUE(
+      BackgroundBlockIndexer::indexMissing(*sql_, *block_store_, 1, log));
+
+  ASSERT_TRUE(
+      BackgroundBlockIndexer::indexMissing(*sql_, *block_store_, 3, log));
+  ASSERT_TRUE(
+      BackgroundBlockIndexer::indexMissing(*sql_, *block_store_, 3, log));
+
+  EXPECT_EQ(indexedHeights(kCreator), (std::vector<HeightType>{1, 2, 3}));
+}
+
+/**
+ * @given a committed height above the blocks in the block storage
+ * @when the missing positions are indexed
+ * @then indexing fails at the absent block
+ */
+TEST_F(BackgroundBlockIndexerTest, IndexMissingFailsWithoutBlock) {
+  storeBlock(1, kCreator);
+
+  EXPECT_FALSE(BackgroundBlockIndexer::indexMissing(
+      *sql_, *block_store_, 2, getTestLogger("BackgroundBlockIndexer")));
+  EXPECT_EQ(indexedHeights(kCreator), (std::vector<HeightType>{1}));
+}
@@ -0,0 +1,147 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/flat_file/block_compressor.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "common/byteutils.hpp"
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+
+class BlockCompressorTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    fs::remove_all(dictionaries_path_);
+  }
+
+  std::unique_ptr<BlockCompressor> createCompressor(bool compress_blocks) {
+    auto compressor =
+        BlockCompressor::create(dictionaries_path_, compress_blocks, log_);
+    EXPECT_TRUE(compressor);
+    return std::move(*compressor);
+  }
+
+  /// Serialized block which shares most of its contents with other blocks
+  BlockCompressor::Bytes makeBlock(size_t height) {
+    return iroha::stringToBytes(
+        R"({"blockV1":{"payload":{"transactions":[{"payload":{"reducedPayload":)"
+        R"({"commands":[{"transferAsset":{"srcAccountId":"alice@test",)"
+        R"("destAccountId":"bob@test","assetId":"coin#test","amount":"1.0"}}],)"
+        R"("creatorAccountId":"alice@test","quorum":1}}}],"height":")"
+        + std::to_string(height) + R"("}}})");
+  }
+
+  const std::string dictionaries_path_ =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  logger::LoggerPtr log_ = getTestLogger("BlockCompressor");
+};
+
+/**
+ * @given compressor without a dictionary
+ * @when a block is compressed
+ * @then it is recognized as compressed and restored by decompression
+ */
+TEST_F(BlockCompressorTest, CompressWithoutDictionary) {
+  auto compressor = createCompressor(true);
+  auto block = makeBlock(1);
+
+  auto compressed = compressor->compress(block);
+
+  EXPECT_FALSE(BlockCompressor::isCompressed(block));
+  EXPECT_TRUE(BlockCompressor::isCompressed(compressed));
+  auto decompressed = compressor->decompress(compressed);
+  ASSERT_TRUE(decompressed);
+  EXPECT_EQ(*decompressed, block);
+}
+
+/**
+ * @given compressor with compression turned off
+ * @when a block is compressed
+ * @then it is returned unchanged
+ */
+TEST_F(BlockCompressorTest, CompressionOff) {
+  auto compressor = createCompressor(false);
+  auto block = makeBlock(1);
+
+  EXPECT_EQ(compressor->compress(block), block);
+}
+
+/**
+ * @given compressor which has compressed enough blocks to build a dictionary
+ * @when a block is compressed with the dictionary
+ * @then it is smaller than the block compressed without a dictionary
+ * @and both blocks are restored by a new compressor on the same directory
+ */
+TEST_F(BlockCompressorTest, DictionaryIsBuiltAndReloaded) {
+  auto compressor = createCompressor(true);
+  auto first_compressed = compressor->compress(makeBlock(1));
+  for (size_t height = 2; height <= BlockCompressor::kTrainingBlocks;
+       ++height) {
+    compressor->compress(makeBlock(height));
+  }
+  ASSERT_GT(compressor->dictionarySize(), 0);
+
+  auto block = makeBlock(BlockCompressor::kTrainingBlocks + 1);
+  auto compressed = compressor->compress(block);
+  EXPECT_LT(compressed.size(), first_compressed.size());
+
+  auto reloaded = createCompressor(false);
+  auto decompressed = reloaded->decompress(compressed);
+  ASSERT_TRUE(decompressed);
+  EXPECT_EQ(*decompressed, block);
+  auto first_decompressed = reloaded->decompress(first_compressed);
+  ASSERT_TRUE(first_decompressed);
+  EXPECT_EQ(*first_decompressed, makeBlock(1));
+}
+
+/**
+ * @given block compressed with a dictionary
+ * @when the dictionaries are cleared and the block is decompressed
+ * @then decompression fails
+ */
+TEST_F(BlockCompressorTest, UnknownDictionary) {
+  auto compressor = createCompressor(true);
+  for (size_t height = 1; height <= BlockCompressor::kTrainingBlocks;
+       ++height) {
+    compressor->compress(makeBlock(height));
+  }
+  auto compressed =
+      compressor->compress(makeBlock(BlockCompressor::kTrainingBlocks + 1));
+
+  compressor->clear();
+
+  EXPECT_FALSE(compressor->decompress(compressed));
+}
+
+/**
+ * @given compressor which has built a dictionary from identical blocks
+ * @when the dictionary is rebuilt from the same blocks
+ * @then the new dictionary, which has the checksum of the previous one, is
+ * not saved
+ * @and blocks compressed with the previous dictionary are restored
+ */
+TEST_F(BlockCompressorTest, DictionaryWithUsedChecksumIsRejected) {
+  auto compressor = createCompressor(true);
+  const auto block = makeBlock(1);
+  for (size_t i = 0; i < BlockCompressor::kTrainingBlocks; ++i) {
+    compressor->compress(block);
+  }
+  auto compressed = compressor->compress(block);
+
+  for (size_t i = 1; i < BlockCompressor::kRetrainPeriod; ++i) {
+    compressor->compress(block);
+  }
+
+  EXPECT_EQ(std::distance(fs::directory_iterator{dictionaries_path_},
+                          fs::directory_iterator{}),
+            1);
+  auto reloaded = createCompressor(false);
+  auto decompressed = reloaded->decompress(compressed);
+  ASSERT_TRUE(decompressed);
+  EXPECT_EQ(*decompressed, block);
+}
@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/indexed_height.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+/**
+ * @given indexes at the committed height
+ * @when the indexes are awaited
+ * @then the wait returns at once
+ */
+TEST(IndexedHeightTest, WaitWhenIndexed) {
+  IndexedHeight height;
+  height.committed(3);
+  height.indexed(3);
+
+  EXPECT_TRUE(height.waitIndexed(0ms));
+}
+
+/**
+ * @given indexes which lag behind the committed height
+ * @when the indexes are awaited and are not written in time
+ * @then the wait times out
+ */
+TEST(IndexedHeightTest, WaitTimesOut) {
+  IndexedHeight height;
+  height.committed(3);
+  height.indexed(2);
+
+  EXPECT_FALSE(height.waitIndexed(10ms));
+}
+
+/**
+ * @given indexes which lag behind the committed height
+ * @when the indexes are awaited and another thread indexes the blocks
+ * @then the wait returns true
+ */
+TEST(IndexedHeightTest, WaitUntilIndexed) {
+  IndexedHeight height;
+  height.committed(3);
+  height.indexed(1);
+
+  std::thread indexer([&height] {
+    height.indexed(2);
+    height.indexed(3);
+  });
+
+  EXPECT_TRUE(height.waitIndexed(10s));
+  EXPECT_EQ(height.getIndexed(), 3);
+  indexer.join();
+}
@@ -27,6 +27,9 @@ namespace iroha {
                    bool(std::shared_ptr<const shared_model::interface::Block>));
       MOCK_METHOD1(applyPrepared,
                    bool(std::shared_ptr<const shared_model::interface::Block>));
+      MOCK_CONST_METHOD0(
+          getLedgerState,
+          boost::optional<std::shared_ptr<const iroha::LedgerState>>());
       MOCK_METHOD0(
           do_commit,
           expected::Result<MutableStorage::CommitResult, std::string>());
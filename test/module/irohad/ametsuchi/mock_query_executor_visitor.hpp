@@ -15,8 +15,10 @@ namespace iroha {
 
     class MockSpecificQueryExecutor : public SpecificQueryExecutor {
      public:
-      MOCK_METHOD1(execute,
-                   QueryExecutorResult(const shared_model::interface::Query &));
+      MOCK_METHOD2(
+          execute,
+          QueryExecutorResult(const shared_model::interface::Query &,
+                              shared_model::interface::types::HeightType));
 
       MOCK_CONST_METHOD2(
           hasAccountRolePermission,
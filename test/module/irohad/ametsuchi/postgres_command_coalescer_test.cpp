@@ -0,0 +1,161 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_command_coalescer.hpp"
+
+#include <gtest/gtest.h>
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/postgres_specific_query_executor.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "datetime/time.hpp"
+#include "framework/result_fixture.hpp"
+#include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
+#include "module/irohad/pending_txs_storage/pending_txs_storage_mock.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace std::literals;
+using namespace framework::expected;
+
+using shared_model::interface::types::PublicKeyHexStringView;
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class PostgresCommandCoalescerTest : public AmetsuchiTest {
+     public:
+      void SetUp() override {
+        AmetsuchiTest::SetUp();
+
+        auto perm_converter =
+            std::make_shared<shared_model::proto::ProtoPermissionToString>();
+        auto executor = std::make_shared<PostgresCommandExecutor>(
+            std::make_unique<soci::session>(*soci::factory_postgresql(),
+                                            pgopt_),
+            perm_converter,
+            std::make_shared<PostgresSpecificQueryExecutor>(
+                *sql,
+                *block_storage_,
+                std::make_shared<MockPendingTransactionStorage>(),
+                std::make_shared<
+                    shared_model::proto::ProtoQueryResponseFactory>(),
+                perm_converter,
+                getTestLoggerManager()
+                    ->getChild("SpecificQueryExecutor")
+                    ->getLogger()),
+            std::nullopt);
+        coalescer_ = std::make_unique<PostgresCommandCoalescer>(
+            executor, getTestLogger("CommandCoalescer"));
+
+        shared_model::interface::RolePermissionSet permissions;
+        ASSERT_TRUE(val(execute({tx()
+                                     .createRole(kRole, permissions)
+                                     .createDomain(kDomain, kRole)
+                                     .createAccount("id", kDomain, kPubkey)
+                                     .createAccount("id2", kDomain, kPubkey)
+                                     .createAsset("coin", kDomain, 1)
+                                     .addAssetQuantity(kAsset, "10.0")
+                                     .build()})));
+      }
+
+      /// Builder of a transaction of the first account
+      auto tx() const {
+        return TestTransactionBuilder()
+            .creatorAccountId(kAccount)
+            .createdTime(iroha::time::now() + counter_++)
+            .quorum(1);
+      }
+
+      iroha::expected::Result<void, TxExecutionError> execute(
+          const std::vector<shared_model::proto::Transaction> &txs) {
+        return coalescer_->execute(txs);
+      }
+
+      std::string balance(const std::string &account_id) {
+        std::string amount;
+        *sql << "SELECT amount::text FROM account_has_asset "
+                "WHERE account_id = :account_id AND asset_id = :asset_id",
+            soci::use(account_id, "account_id"), soci::use(kAsset, "asset_id"),
+            soci::into(amount);
+        return amount;
+      }
+
+      std::string detail(const std::string &key) {
+        std::string value;
+        *sql << "SELECT data -> :writer ->> :key FROM account "
+                "WHERE account_id = :account_id",
+            soci::use(kAccount, "writer"), soci::use(key, "key"),
+            soci::use(kAccount2, "account_id"), soci::into(value);
+        return value;
+      }
+
+      const std::string kRole = "role";
+      const std::string kDomain = "domain";
+      const std::string kAccount = "id@domain";
+      const std::string kAccount2 = "id2@domain";
+      const std::string kAsset = "coin#domain";
+      const PublicKeyHexStringView kPubkey{"pubkey"sv};
+
+      mutable size_t counter_ = 0;
+      std::unique_ptr<PostgresCommandCoalescer> coalescer_;
+    };
+
+    /**
+     * @given transfers in both directions across several transactions
+     * @when they are executed by the coalescer
+     * @then the balances are the same as after sequential execution
+     */
+    TEST_F(PostgresCommandCoalescerTest, AppliesTransfers) {
+      ASSERT_TRUE(val(execute(
+          {tx().transferAsset(kAccount, kAccount2, kAsset, "", "3.0")
+               .transferAsset(kAccount, kAccount2, kAsset, "", "4.0")
+               .build(),
+           tx().transferAsset(kAccount2, kAccount, kAsset, "", "5.0")
+               .transferAsset(kAccount, kAccount2, kAsset, "", "8.0")
+               .build()})));
+
+      EXPECT_EQ(balance(kAccount), "0.0");
+      EXPECT_EQ(balance(kAccount2), "10.0");
+    }
+
+    /**
+     * @given a run of transfers, the second of which exceeds the balance
+     * @when they are executed by the coalescer
+     * @then the first transfer is applied and the error of the second is the
+     * one of sequential execution
+     */
+    TEST_F(PostgresCommandCoalescerTest, ReportsFailedTransfer) {
+      auto result = execute(
+          {tx().transferAsset(kAccount, kAccount2, kAsset, "", "6.0").build(),
+           tx().transferAsset(kAccount, kAccount2, kAsset, "", "6.0")
+               .build()});
+
+      auto error = err(result);
+      ASSERT_TRUE(error);
+      EXPECT_EQ(error->error.command_error.error_code, 6);
+      EXPECT_EQ(error->error.command_index, 0);
+      EXPECT_EQ(balance(kAccount), "4.0");
+      EXPECT_EQ(balance(kAccount2), "6.0");
+    }
+
+    /**
+     * @given details set several times for the same keys
+     * @when they are executed by the coalescer
+     * @then the last value of each key is stored
+     */
+    TEST_F(PostgresCommandCoalescerTest, AppliesLastDetails) {
+      ASSERT_TRUE(val(execute({tx().setAccountDetail(kAccount2, "a", "1")
+                                   .setAccountDetail(kAccount2, "b", "2")
+                                   .build(),
+                               tx().setAccountDetail(kAccount2, "a", "3")
+                                   .build()})));
+
+      EXPECT_EQ(detail("a"), "3");
+      EXPECT_EQ(detail("b"), "2");
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
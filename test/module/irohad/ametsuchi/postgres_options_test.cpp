@@ -164,3 +164,25 @@ TEST(PostgresOptionsTest, SeparateParams) {
               default_working_dbname,
               "maintenance_dbname");
 }
+
+/**
+ * @given PostgresOptions object
+ * @when options for another server are created from it
+ * @then they have the new host and port
+ * AND the rest of the connection parameters are the same
+ */
+TEST(PostgresOptionsTest, AnotherServer) {
+  auto pg_opt = PostgresOptions(
+      "main", 5432, "petya", "friend", "working", "maintenance", test_log);
+
+  auto standby_opt = PostgresOptions(pg_opt, "standby", 5433);
+
+  checkPgOpts(standby_opt,
+              "standby",
+              "5433",
+              "petya",
+              "friend",
+              "working",
+              "maintenance");
+  EXPECT_EQ(standby_opt.preparedBlockName(), pg_opt.preparedBlockName());
+}
@@ -456,6 +456,20 @@ namespace iroha {
           });
     }
 
+    /**
+     * @given initialized storage with committed blocks
+     * @when a query is executed
+     * @then the response reports the height of the ledger it was made from
+     */
+    TEST_F(GetBlockExecutorTest, ResponseReportsLedgerHeight) {
+      addPerms({shared_model::interface::permissions::Role::kGetBlocks});
+      commitBlocks();
+      auto query =
+          TestQueryBuilder().creatorAccountId(account_id).getBlock(1).build();
+      auto result = executeQuery(query);
+      EXPECT_EQ(result->height(), kLedgerHeight);
+    }
+
     class GetRolesExecutorTest : public QueryExecutorTest {
      public:
       void SetUp() override {
@@ -158,3 +158,57 @@ TEST_F(StorageInitTest, CreateStorageWithInvalidPgOpt) {
   pool.match([](const auto &) { FAIL() << "storage created, but should not"; },
              [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given working database created before account_has_asset_count was added
+ * @when the database is reused
+ * @then the table is created and filled with the numbers of account assets
+ */
+TEST_F(StorageInitTest, ReusedDatabaseIsMigrated) {
+  auto options = std::make_unique<PostgresOptions>(
+      pgopt_,
+      integration_framework::kDefaultWorkingDatabaseName,
+      storage_log_manager_->getLogger());
+
+  PgConnectionInit::prepareWorkingDatabase(iroha::StartupWsvDataPolicy::kDrop,
+                                           *options)
+      .match([](auto &&val) {}, [&](auto &&error) { FAIL() << error.error; });
+
+  soci::session sql(*soci::factory_postgresql(), pgopt_);
+  sql << R"(
+    DROP TABLE account_has_asset_count;
+    DROP TABLE schema_migration;
+    INSERT INTO role VALUES ('user');
+    INSERT INTO domain VALUES ('test', 'user');
+    INSERT INTO account (account_id, domain_id, quorum)
+        VALUES ('alice@test', 'test', 1), ('bob@test', 'test', 1);
+    INSERT INTO asset VALUES ('coin#test', 'test', 2), ('gem#test', 'test', 0);
+    INSERT INTO account_has_asset VALUES
+        ('alice@test', 'coin#test', 1),
+        ('alice@test', 'gem#test', 2),
+        ('bob@test', 'coin#test', 3);
+  )";
+
+  PgConnectionInit::prepareWorkingDatabase(iroha::StartupWsvDataPolicy::kReuse,
+                                           *options)
+      .match([](auto &&val) {}, [&](auto &&error) { FAIL() << error.error; });
+
+  auto asset_count = [&sql](const std::string &account_id) {
+    long long count = 0;
+    sql << "SELECT asset_count FROM account_has_asset_count "
+           "WHERE account_id = :account_id",
+        soci::into(count), soci::use(account_id);
+    return count;
+  };
+  EXPECT_EQ(asset_count("alice@test"), 2);
+  EXPECT_EQ(asset_count("bob@test"), 1);
+
+  int migrations = 0;
+  sql << "SELECT count(*) FROM schema_migration "
+         "WHERE name = 'account_has_asset_count'",
+      soci::into(migrations);
+  EXPECT_EQ(migrations, 1);
+  sql.close();
+
+  PgConnectionInit::dropWorkingDatabase(*options);
+}
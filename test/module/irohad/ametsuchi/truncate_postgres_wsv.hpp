@@ -16,6 +16,7 @@ namespace iroha {
         TRUNCATE TABLE top_block_info;
         TRUNCATE TABLE account_has_signatory RESTART IDENTITY CASCADE;
         TRUNCATE TABLE account_has_asset RESTART IDENTITY CASCADE;
+        TRUNCATE TABLE account_has_asset_count RESTART IDENTITY CASCADE;
         TRUNCATE TABLE role_has_permissions RESTART IDENTITY CASCADE;
         TRUNCATE TABLE account_has_roles RESTART IDENTITY CASCADE;
         TRUNCATE TABLE account_has_grantable_permissions RESTART IDENTITY CASCADE;
@@ -5,7 +5,10 @@
 
 #include "main/raw_block_loader.hpp"
 
+#include <sstream>
+
 #include <gtest/gtest.h>
+#include "block.pb.h"
 #include "framework/result_gtest_checkers.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/transaction.hpp"
@@ -44,3 +47,75 @@ TEST(BlockLoaderTest, BlockLoaderJsonParsing) {
   ASSERT_EQ(b->prevHash().hex(),
             "0101010101010101010101010101010101010101010101010101010101010101");
 }
+
+/**
+ * @given block serialized to binary protobuf
+ * @when parsing the block from stream using raw block loader
+ * @then check that the block is correct
+ */
+TEST(BlockLoaderTest, BlockLoaderBinaryParsing) {
+  iroha::protocol::Block proto;
+  auto &payload = *proto.mutable_block_v1()->mutable_payload();
+  payload.set_height(1);
+  payload.set_created_time(42);
+  payload.set_prev_block_hash(std::string(64, '0'));
+  payload.add_transactions()
+      ->mutable_payload()
+      ->mutable_reduced_payload()
+      ->set_creator_account_id("admin@test");
+  payload.set_tx_number(1);
+  std::istringstream input(proto.SerializeAsString());
+
+  auto block = BlockLoader::parseBinaryBlock(input);
+
+  IROHA_ASSERT_RESULT_VALUE(block);
+  auto b = std::move(block).assumeValue();
+
+  ASSERT_EQ(b->transactions().size(), 1);
+  ASSERT_EQ(b->transactions()[0].creatorAccountId(), "admin@test");
+  ASSERT_EQ(b->height(), 1);
+  ASSERT_EQ(b->createdTime(), 42);
+}
+
+/**
+ * @given JSON transactions, one per line, with an empty line between them
+ * @when parsing them using raw block loader
+ * @then genesis block with the transactions in order is made
+ */
+TEST(BlockLoaderTest, BlockLoaderTransactionsParsing) {
+  std::istringstream input(
+      R"({"payload": {"reducedPayload": {"creatorAccountId": "a@test"}}})"
+      "\n\n"
+      R"({"payload": {"reducedPayload": {"creatorAccountId": "b@test"}}})"
+      "\n");
+
+  auto block = BlockLoader::parseTransactions(input);
+
+  IROHA_ASSERT_RESULT_VALUE(block);
+  auto b = std::move(block).assumeValue();
+
+  ASSERT_EQ(b->transactions().size(), 2);
+  ASSERT_EQ(b->transactions()[0].creatorAccountId(), "a@test");
+  ASSERT_EQ(b->transactions()[1].creatorAccountId(), "b@test");
+  ASSERT_EQ(b->txsNumber(), 2);
+  ASSERT_EQ(b->height(), 1);
+  ASSERT_EQ(b->prevHash().hex(), std::string(64, '0'));
+}
+
+/**
+ * @given a line which is not a transaction
+ * @when parsing transactions using raw block loader
+ * @then the error points to the line
+ */
+TEST(BlockLoaderTest, BlockLoaderTransactionsParsingError) {
+  std::istringstream input(
+      R"({"payload": {"reducedPayload": {"creatorAccountId": "a@test"}}})"
+      "\n"
+      R"({"payload": )"
+      "\n");
+
+  auto block = BlockLoader::parseTransactions(input);
+
+  IROHA_ASSERT_RESULT_ERROR(block);
+  ASSERT_NE(block.assumeError().find("line 2"), std::string::npos);
+}
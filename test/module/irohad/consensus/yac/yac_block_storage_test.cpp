@@ -102,3 +102,26 @@ TEST_F(YacBlockStorageTest, YacBlockStorageWhenIsContains) {
   ASSERT_TRUE(storage.isContains(valid_votes.at(0)));
   ASSERT_FALSE(storage.isContains(valid_votes.at(3)));
 }
+
+/**
+ * @given block storage with a vote of a peer
+ * @when another vote of the same peer with a different signature is inserted
+ * @then the vote is not counted
+ */
+TEST_F(YacBlockStorageTest, YacBlockStorageWhenSamePeerVotesTwice) {
+  storage.insert(valid_votes.at(0));
+
+  auto second_vote = valid_votes.at(0);
+  auto signature = std::make_shared<MockSignature>();
+  EXPECT_CALL(*signature, publicKey())
+      .WillRepeatedly(
+          ::testing::ReturnRefOfCopy(valid_votes.at(0).signature->publicKey()));
+  EXPECT_CALL(*signature, signedData())
+      .WillRepeatedly(::testing::ReturnRefOfCopy(std::string("another")));
+  second_vote.signature = signature;
+
+  storage.insert(second_vote);
+  ASSERT_EQ(1, storage.getNumberOfVotes());
+  ASSERT_TRUE(storage.isContains(valid_votes.at(0)));
+  ASSERT_FALSE(storage.isContains(second_vote));
+}
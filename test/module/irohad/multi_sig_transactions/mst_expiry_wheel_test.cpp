@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "multi_sig_transactions/storage/mst_expiry_wheel.hpp"
+
+#include <gtest/gtest.h>
+#include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
+
+using namespace iroha;
+
+class MstExpiryWheelTest : public testing::Test {
+ public:
+  DataType batch(shared_model::interface::types::CounterType counter) {
+    return makeTestBatch(txBuilder(counter, creation_time));
+  }
+
+  size_t extract(TimeType current_time) {
+    return wheel.extractExpired(current_time).size();
+  }
+
+  const TimeType creation_time = iroha::time::now();
+  std::shared_ptr<TestCompleter> completer_ =
+      std::make_shared<TestCompleter>();
+  MstState state_a = MstState::empty(getTestLogger("MstState"), completer_);
+  MstState state_b = MstState::empty(getTestLogger("MstState"), completer_);
+  MstExpiryWheel wheel{std::chrono::milliseconds(10)};
+};
+
+/**
+ * @given batches expiring at different times, some of them further than the
+ * span of the lowest level of the wheel
+ * @when expired batches are extracted as the time goes
+ * @then each batch is extracted once after its expiration time
+ */
+TEST_F(MstExpiryWheelTest, ExtractsInOrderOfExpiration) {
+  wheel.extractExpired(creation_time);
+  const std::vector<TimeType> delays{5, 700, 20, 100000, 30000000};
+  for (size_t i = 0; i < delays.size(); ++i) {
+    wheel.add(batch(i), creation_time + delays[i], state_a);
+  }
+  ASSERT_EQ(delays.size(), wheel.size());
+
+  EXPECT_EQ(0, extract(creation_time + 5));
+  EXPECT_EQ(1, extract(creation_time + 6));
+  EXPECT_EQ(1, extract(creation_time + 21));
+  EXPECT_EQ(0, extract(creation_time + 700));
+  EXPECT_EQ(1, extract(creation_time + 5000));
+  EXPECT_EQ(1, extract(creation_time + 100001));
+  EXPECT_EQ(1, wheel.size());
+  EXPECT_EQ(1, extract(creation_time + 40000000));
+  EXPECT_EQ(0, wheel.size());
+}
+
+/**
+ * @given a batch held by two states
+ * @when it expires
+ * @then it is extracted once with both holders
+ */
+TEST_F(MstExpiryWheelTest, SharesBatchBetweenStates) {
+  auto expiring = batch(1);
+  wheel.add(expiring, creation_time, state_a);
+  wheel.add(batch(1), creation_time, state_b);
+  ASSERT_EQ(1, wheel.size());
+
+  auto expired = wheel.extractExpired(creation_time + 1);
+  ASSERT_EQ(1, expired.size());
+  EXPECT_EQ(2, expired.front().holders.size());
+  EXPECT_EQ(0, wheel.size());
+}
+
+/**
+ * @given a batch held by two states
+ * @when both states drop it
+ * @then the batch is removed from the wheel and never extracted
+ */
+TEST_F(MstExpiryWheelTest, RemovesBatchWithoutHolders) {
+  wheel.add(batch(1), creation_time, state_a);
+  wheel.add(batch(1), creation_time, state_b);
+
+  wheel.remove(batch(1), state_a);
+  EXPECT_EQ(1, wheel.size());
+  wheel.remove(batch(1), state_b);
+  EXPECT_EQ(0, wheel.size());
+  EXPECT_EQ(0, extract(creation_time + 1));
+}
+
+/**
+ * @given a batch which is extracted later than its expiration
+ * @when it is extracted
+ * @then the expiry lag is the delay of the extraction
+ */
+TEST_F(MstExpiryWheelTest, ReportsExpiryLag) {
+  wheel.add(batch(1), creation_time, state_a);
+
+  EXPECT_EQ(1, extract(creation_time + 250));
+  EXPECT_EQ(std::chrono::milliseconds(250), wheel.lastExpiryLag());
+}
@@ -173,3 +173,26 @@ TEST_F(StorageTest, DiffStateContainsNewSignature) {
                        Contains(Property(&Signature::publicKey,
                                          Eq(keypairs[1].publicKey())))))))))));
 }
+
+/**
+ * @given storage with own batches and batches applied from a peer
+ * @when expired transactions are extracted
+ * @then batches expire in both own and peer states once, and no batch is
+ * pending expiration
+ */
+TEST_F(StorageTest, ExpiredBatchesAreRemovedFromPeerStates) {
+  shared_model::interface::types::PublicKeyHexStringView const peer_key{
+      std::string_view{"0B"}};
+  auto new_state = MstState::empty(getTestLogger("MstState"), completer_);
+  new_state += makeTestBatch(txBuilder(1, creation_time));
+  new_state += makeTestBatch(txBuilder(5, creation_time));
+  storage->apply(peer_key, new_state);
+  ASSERT_EQ(4, storage->expiryMetrics().pending_batches);
+
+  EXPECT_EQ(4,
+            storage->extractExpiredTransactions(creation_time + 1)
+                .getBatches()
+                .size());
+  EXPECT_EQ(0, storage->expiryMetrics().pending_batches);
+  EXPECT_EQ(2, storage->whatsNew(new_state).getBatches().size());
+}
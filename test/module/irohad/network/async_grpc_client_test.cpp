@@ -0,0 +1,234 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/async_grpc_client.hpp"
+
+#include <chrono>
+#include <future>
+#include <set>
+
+#include <gtest/gtest.h>
+#include <grpcpp/alarm.h>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::network;
+using namespace std::chrono_literals;
+
+using Response = google::protobuf::Empty;
+
+namespace {
+  /**
+   * Response reader of a call which is not sent anywhere. The call is
+   * completed by the test through an alarm on its completion queue.
+   */
+  class ManualResponseReader
+      : public grpc::ClientAsyncResponseReaderInterface<Response> {
+   public:
+    explicit ManualResponseReader(grpc::CompletionQueue *cq) : cq_(cq) {}
+
+    void StartCall() override {}
+
+    void ReadInitialMetadata(void *) override {}
+
+    void Finish(Response *, grpc::Status *status, void *tag) override {
+      status_ = status;
+      tag_ = tag;
+    }
+
+    void complete() {
+      *status_ = grpc::Status::OK;
+      alarm_.Set(cq_, gpr_now(GPR_CLOCK_REALTIME), tag_);
+    }
+
+    grpc::CompletionQueue *const cq_;
+
+   private:
+    grpc::Alarm alarm_;
+    grpc::Status *status_ = nullptr;
+    void *tag_ = nullptr;
+  };
+}  // namespace
+
+class AsyncGrpcClientTest : public ::testing::Test {
+ public:
+  void createClient(size_t queues, size_t max_in_flight_per_peer) {
+    client_ = std::make_unique<AsyncGrpcClient<Response>>(
+        getTestLogger("AsyncGrpcClient"), queues, max_in_flight_per_peer);
+  }
+
+  /**
+   * Lambda for Call and CallPeer which creates a reader owned by the test, as
+   * gRPC does not delete the readers of the calls
+   */
+  auto makeCall() {
+    return [this](grpc::ClientContext *, grpc::CompletionQueue *cq) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      readers_.push_back(std::make_unique<ManualResponseReader>(cq));
+      return std::unique_ptr<
+          grpc::ClientAsyncResponseReaderInterface<Response>>(
+          readers_.back().get());
+    };
+  }
+
+  /// @return reader of the call started with the given index
+  ManualResponseReader *reader(size_t index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return readers_.at(index).get();
+  }
+
+  size_t startedCalls() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return readers_.size();
+  }
+
+  /// Wait until the response handler is called for the given number of calls
+  bool waitResponses(size_t count) {
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (responses_ < count) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(1ms);
+    }
+    return true;
+  }
+
+  AsyncGrpcClient<Response>::OnResponse countResponse() {
+    return [this](grpc::Status &status, Response &) {
+      EXPECT_TRUE(status.ok());
+      ++responses_;
+    };
+  }
+
+  const std::string kPeer = "127.0.0.1:10001";
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<ManualResponseReader>> readers_;
+  std::unique_ptr<AsyncGrpcClient<Response>> client_;
+  std::atomic<size_t> responses_{0};
+};
+
+/**
+ * @given client with several completion queues
+ * @when calls are sent without a peer and to a single peer
+ * @then calls without a peer are spread over all queues
+ * @and calls to the peer go to the same queue
+ */
+TEST_F(AsyncGrpcClientTest, QueuesOfCalls) {
+  createClient(4, 0);
+  for (size_t i = 0; i < 4; ++i) {
+    client_->Call(makeCall(), countResponse());
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    client_->CallPeer(kPeer, makeCall(), countResponse());
+  }
+
+  std::set<grpc::CompletionQueue *> call_queues, peer_queues;
+  for (size_t i = 0; i < 4; ++i) {
+    call_queues.insert(reader(i)->cq_);
+    peer_queues.insert(reader(4 + i)->cq_);
+  }
+  EXPECT_EQ(call_queues.size(), 4);
+  EXPECT_EQ(peer_queues.size(), 1);
+
+  for (size_t i = 0; i < 8; ++i) {
+    reader(i)->complete();
+  }
+  EXPECT_TRUE(waitResponses(8));
+  EXPECT_EQ(client_->inFlight(kPeer), 0);
+}
+
+/**
+ * @given client with the limit of two calls in flight per peer
+ * @when the third call to the peer is made while two calls are unfinished
+ * @then the caller is blocked and the call is not sent
+ * @and the call is sent after one of the previous calls finishes
+ * @and all calls complete with their responses
+ */
+TEST_F(AsyncGrpcClientTest, CallOverLimitWaits) {
+  createClient(1, 2);
+  client_->CallPeer(kPeer, makeCall(), countResponse());
+  client_->CallPeer(kPeer, makeCall(), countResponse());
+  EXPECT_EQ(client_->inFlight(kPeer), 2);
+
+  auto third = std::async(std::launch::async, [this] {
+    client_->CallPeer(kPeer, makeCall(), countResponse());
+  });
+  EXPECT_EQ(third.wait_for(100ms), std::future_status::timeout);
+  EXPECT_EQ(startedCalls(), 2);
+
+  reader(0)->complete();
+  ASSERT_EQ(third.wait_for(5s), std::future_status::ready);
+  EXPECT_EQ(startedCalls(), 3);
+  EXPECT_EQ(client_->inFlight(kPeer), 2);
+
+  reader(1)->complete();
+  reader(2)->complete();
+  EXPECT_TRUE(waitResponses(3));
+  EXPECT_EQ(client_->inFlight(kPeer), 0);
+}
+
+/**
+ * @given client with the limit of one call in flight per peer
+ * @when a response handler makes a call to the peer over the limit
+ * @then the call is sent without waiting, as the handler runs on the thread
+ * which finishes the calls
+ */
+TEST_F(AsyncGrpcClientTest, ResponseHandlerIsNotBlocked) {
+  createClient(1, 1);
+  client_->CallPeer(kPeer, makeCall(), [this](grpc::Status &, Response &) {
+    client_->CallPeer(kPeer, makeCall(), countResponse());
+    ++responses_;
+  });
+
+  reader(0)->complete();
+  ASSERT_TRUE(waitResponses(1));
+  ASSERT_EQ(startedCalls(), 2);
+  reader(1)->complete();
+  EXPECT_TRUE(waitResponses(2));
+  EXPECT_EQ(client_->inFlight(kPeer), 0);
+}
+
+/**
+ * @given client with two completion queues and the limit of one call in flight
+ * per peer
+ * @and a call to each of two peers of different queues, whose response
+ * handler makes a call to the other peer
+ * @when both calls finish
+ * @then neither handler waits for the call of the other one, which is in
+ * flight until its handler returns
+ */
+TEST_F(AsyncGrpcClientTest, CrossQueueResponseHandlersAreNotBlocked) {
+  createClient(2, 1);
+  // peers are assigned to the queues by the hash of their address
+  const auto queue = [](const std::string &peer) {
+    return std::hash<std::string>{}(peer) % 2;
+  };
+  std::string other_peer;
+  size_t port = 10001;
+  do {
+    other_peer = "127.0.0.1:" + std::to_string(++port);
+  } while (queue(other_peer) == queue(kPeer));
+
+  const auto call_other = [this](const std::string &peer) {
+    return [this, peer](grpc::Status &, Response &) {
+      client_->CallPeer(peer, makeCall(), countResponse());
+      ++responses_;
+    };
+  };
+  client_->CallPeer(kPeer, makeCall(), call_other(other_peer));
+  client_->CallPeer(other_peer, makeCall(), call_other(kPeer));
+  ASSERT_NE(reader(0)->cq_, reader(1)->cq_);
+
+  reader(0)->complete();
+  reader(1)->complete();
+  ASSERT_TRUE(waitResponses(2));
+  ASSERT_EQ(startedCalls(), 4);
+  reader(2)->complete();
+  reader(3)->complete();
+  EXPECT_TRUE(waitResponses(4));
+  EXPECT_EQ(client_->inFlight(kPeer), 0);
+  EXPECT_EQ(client_->inFlight(other_peer), 0);
+}
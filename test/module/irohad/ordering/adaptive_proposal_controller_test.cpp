@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_proposal_controller.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+class AdaptiveProposalControllerTest : public ::testing::Test {
+ public:
+  std::unique_ptr<AdaptiveProposalController> makeController(
+      std::chrono::milliseconds target_round_time,
+      std::chrono::milliseconds max_round_delay = 0ms) {
+    return std::make_unique<AdaptiveProposalController>(
+        AdaptiveProposalController::Config{
+            kMinSize, kMaxSize, target_round_time, max_round_delay},
+        getTestLogger("AdaptiveProposalController"));
+  }
+
+  /// Pass a round through the controller
+  void round(AdaptiveProposalController &controller,
+             std::chrono::milliseconds duration = 0ms) {
+    iroha::consensus::Round round{++height_, 0};
+    controller.onProposal(round, controller.lastDecision().proposal_size);
+    std::this_thread::sleep_for(duration);
+    controller.onVerifiedProposal(round);
+    controller.onCommit(round.block_round);
+  }
+
+  const size_t kMinSize = 10;
+  const size_t kMaxSize = 100;
+  iroha::consensus::BlockRoundType height_ = 0;
+};
+
+/**
+ * @given a controller
+ * @when rounds take longer than the target time
+ * @then the proposal size is halved down to the lower bound
+ */
+TEST_F(AdaptiveProposalControllerTest, ShrinksSlowRounds) {
+  auto controller = makeController(1ms);
+  EXPECT_EQ(controller->proposalSize(1000), kMaxSize);
+
+  round(*controller, 5ms);
+  EXPECT_EQ(controller->proposalSize(1000), kMaxSize / 2);
+  for (int i = 0; i < 5; ++i) {
+    round(*controller, 5ms);
+  }
+  EXPECT_EQ(controller->proposalSize(1000), kMinSize);
+}
+
+/**
+ * @given a controller with a shrunk proposal size
+ * @when rounds fit the target time and more transactions are queued than fit
+ * a proposal
+ * @then the proposal size grows up to the upper bound
+ */
+TEST_F(AdaptiveProposalControllerTest, GrowsWhenQueueExceedsSize) {
+  auto controller = makeController(50ms);
+  round(*controller, 100ms);
+  ASSERT_EQ(controller->proposalSize(1000), kMaxSize / 2);
+
+  round(*controller);
+  EXPECT_GT(controller->proposalSize(1000), kMaxSize / 2);
+  for (int i = 0; i < 20; ++i) {
+    round(*controller);
+    controller->proposalSize(1000);
+  }
+  EXPECT_EQ(controller->lastDecision().proposal_size, kMaxSize);
+}
+
+/**
+ * @given a controller with fast rounds
+ * @when the queued transactions do not fill a proposal
+ * @then the round is delayed within the bound, and is not delayed when the
+ * queue fills the proposal
+ */
+TEST_F(AdaptiveProposalControllerTest, DelaysUnfilledRounds) {
+  auto controller = makeController(1h, 200ms);
+  round(*controller);
+
+  controller->proposalSize(kMaxSize / 2);
+  EXPECT_EQ(controller->roundDelay(), 200ms);
+  EXPECT_EQ(controller->lastDecision().queue_depth, kMaxSize / 2);
+
+  controller->proposalSize(kMaxSize);
+  EXPECT_EQ(controller->roundDelay(), 0ms);
+}
+
+/**
+ * @given a controller
+ * @when a block of another round is committed
+ * @then the measured round is not finished and the size is kept
+ */
+TEST_F(AdaptiveProposalControllerTest, IgnoresOtherRounds) {
+  auto controller = makeController(1ms);
+  iroha::consensus::Round round{1, 0};
+  controller->onProposal(round, kMaxSize);
+  std::this_thread::sleep_for(5ms);
+  controller->onVerifiedProposal({1, 1});
+  controller->onCommit(2);
+
+  EXPECT_EQ(controller->proposalSize(1000), kMaxSize);
+}
@@ -17,9 +17,11 @@ using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
+using ::testing::_;
 using ::testing::ByMove;
 using ::testing::Ref;
 using ::testing::Return;
+using ::testing::ReturnRefOfCopy;
 
 /**
  * Create unique_ptr with MockOdOsNotification, save to var, and return it
@@ -52,6 +54,15 @@ struct OnDemandConnectionManagerTest : public ::testing::Test {
         getTestLogger("OsConnectionManager"));
   }
 
+  /// Batch with the given reduced hash
+  static OdOsNotification::TransactionBatchType makeBatch(
+      const std::string &hash) {
+    auto batch = std::make_shared<MockTransactionBatch>();
+    EXPECT_CALL(*batch, reducedHash())
+        .WillRepeatedly(ReturnRefOfCopy(shared_model::crypto::Hash(hash)));
+    return batch;
+  }
+
   OnDemandConnectionManager::CurrentPeers cpeers;
   OnDemandConnectionManager::PeerCollectionType<MockOdOsNotification *>
       connections;
@@ -78,7 +89,7 @@ TEST_F(OnDemandConnectionManagerTest, FactoryUsed) {
  * @then peers get data for propagation
  */
 TEST_F(OnDemandConnectionManagerTest, onBatches) {
-  OdOsNotification::CollectionType collection;
+  OdOsNotification::CollectionType collection{makeBatch("batch")};
 
   auto set_expect = [&](OnDemandConnectionManager::PeerType type) {
     EXPECT_CALL(*connections[type], onBatches(collection)).Times(1);
@@ -131,3 +142,66 @@ TEST_F(OnDemandConnectionManagerTest, onRequestProposalNone) {
 
   ASSERT_FALSE(result);
 }
+
+/**
+ * @given OnDemandConnectionManager
+ * @when the same batch is passed twice
+ * @then peers get it only once
+ */
+TEST_F(OnDemandConnectionManagerTest, BatchSentOnce) {
+  OdOsNotification::CollectionType collection{makeBatch("batch")};
+
+  for (auto &connection : connections) {
+    EXPECT_CALL(*connection, onBatches(collection)).Times(1);
+  }
+
+  manager->onBatches(collection);
+  manager->onBatches(collection);
+}
+
+/**
+ * @given OnDemandConnectionManager where the same peer consumes all rounds
+ * @when onBatches is called
+ * @then the peer gets data for propagation once
+ */
+TEST_F(OnDemandConnectionManagerTest, SamePeerGetsBatchOnce) {
+  OnDemandConnectionManager::CurrentPeers same_peers;
+  same_peers.peers.fill(cpeers.peers[OnDemandConnectionManager::kIssuer]);
+  peers.get_subscriber().on_next(same_peers);
+
+  OdOsNotification::CollectionType collection{makeBatch("batch")};
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kIssuer],
+              onBatches(collection))
+      .Times(1);
+
+  manager->onBatches(collection);
+}
+
+/**
+ * @given OnDemandConnectionManager with a long forwarding window
+ * @when less batches than the maximum per request are passed
+ * @then they are not sent
+ * @and when the maximum is reached, all collected batches are sent at once
+ */
+TEST_F(OnDemandConnectionManagerTest, BatchesCollectedUntilMaximum) {
+  manager = std::make_shared<OnDemandConnectionManager>(
+      factory,
+      peers.get_observable(),
+      cpeers,
+      getTestLogger("OsConnectionManager"),
+      BatchForwardingConfig{std::chrono::hours(1), 2});
+
+  auto first = makeBatch("first"), second = makeBatch("second");
+  for (auto &connection : connections) {
+    EXPECT_CALL(*connection, onBatches(_)).Times(0);
+  }
+  manager->onBatches({first});
+
+  for (auto &connection : connections) {
+    ::testing::Mock::VerifyAndClearExpectations(connection);
+    EXPECT_CALL(*connection,
+                onBatches(OdOsNotification::CollectionType{first, second}))
+        .Times(1);
+  }
+  manager->onBatches({second});
+}
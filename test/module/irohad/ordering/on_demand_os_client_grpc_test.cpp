@@ -27,6 +27,8 @@ using ::testing::Return;
 using ::testing::SaveArg;
 using ::testing::SetArgPointee;
 
+static const std::string kPeerAddress = "127.0.0.1:10001";
+
 class OnDemandOsClientGrpcTest : public ::testing::Test {
  public:
   using ProtoProposalTransportFactory =
@@ -56,6 +58,7 @@ class OnDemandOsClientGrpcTest : public ::testing::Test {
         std::move(validator), std::move(proto_validator));
     client =
         std::make_shared<OnDemandOsClientGrpc>(std::move(ustub),
+                                               kPeerAddress,
                                                async_call,
                                                proposal_factory,
                                                [&] { return timepoint; },
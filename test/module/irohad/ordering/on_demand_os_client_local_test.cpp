@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/on_demand_os_client_local.hpp"
+
+#include <gtest/gtest.h>
+#include "framework/crypto_literals.hpp"
+#include "module/irohad/ordering/mock_on_demand_os_notification.hpp"
+#include "module/irohad/ordering/ordering_mocks.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace iroha::ordering::transport;
+
+using ::testing::_;
+using ::testing::ByMove;
+using ::testing::Return;
+
+struct OnDemandOsClientLocalTest : public ::testing::Test {
+  void SetUp() override {
+    ordering_service = std::make_shared<MockOnDemandOrderingService>();
+    remote_factory = std::make_shared<MockOdOsNotificationFactory>();
+    factory = std::make_shared<OnDemandOsClientLocalFactory>(
+        ordering_service, kPublicKey, remote_factory);
+  }
+
+  const std::string kPublicKey = "abcdef";
+  std::shared_ptr<MockOnDemandOrderingService> ordering_service;
+  std::shared_ptr<MockOdOsNotificationFactory> remote_factory;
+  std::shared_ptr<OnDemandOsClientLocalFactory> factory;
+};
+
+/**
+ * @given factory with the public key of this peer
+ * @when a client for this peer is created and requests are made
+ * @then the requests are passed to the local ordering service
+ */
+TEST_F(OnDemandOsClientLocalTest, LocalPeer) {
+  auto peer = makePeer(
+      "127.0.0.1:10001",
+      shared_model::interface::types::PublicKeyHexStringView{kPublicKey});
+  EXPECT_CALL(*remote_factory, create(_)).Times(0);
+  auto client = factory->create(*peer);
+
+  consensus::Round round{1, 0};
+  OdOsNotification::CollectionType batches;
+  EXPECT_CALL(*ordering_service, onBatches(batches)).Times(1);
+  EXPECT_CALL(*ordering_service, onRequestProposal(round))
+      .WillOnce(Return(boost::none));
+
+  client->onBatches(batches);
+  EXPECT_FALSE(client->onRequestProposal(round));
+}
+
+/**
+ * @given factory with the public key of this peer
+ * @when a client for another peer is created
+ * @then the remote factory creates it
+ */
+TEST_F(OnDemandOsClientLocalTest, RemotePeer) {
+  auto peer = makePeer("127.0.0.1:10002", "fedcba"_hex_pubkey);
+  EXPECT_CALL(*remote_factory, create(_))
+      .WillOnce(Return(ByMove(std::make_unique<MockOdOsNotification>())));
+
+  EXPECT_TRUE(factory->create(*peer));
+}
@@ -662,3 +662,51 @@ TEST_F(PendingTxsStorageFixture, QueryAllTheBatches) {
     checkResponse(second_page.assumeValue(), second_page_expected);
   }
 }
+
+/**
+ * @given a storage with three batches and the cursor of the third batch
+ * @when the second batch is finalized by the hash of its second transaction
+ * @then the batch is removed for all its creators and the cursor still gives
+ * the third batch
+ */
+TEST_F(PendingTxsStorageFixture, CursorSurvivesRemovalByTransactionHash) {
+  auto state = emptyState();
+  auto batch1 = twoTransactionsBatch();
+  auto batch2 = twoTransactionsBatch();
+  auto batch3 = twoTransactionsBatch();
+  *state += batch1;
+  *state += batch2;
+  *state += batch3;
+
+  rxcpp::subjects::subject<shared_model::interface::types::HashType>
+      finalized_txs;
+  auto storage = iroha::PendingTransactionStorageImpl::create(
+      updatesObservable({state}),
+      dummyObservable(),
+      dummyObservable(),
+      dummyPreparedTxsObservable(),
+      finalized_txs.get_observable());
+  auto pc = dummyPresenceCache();
+  storage->insertPresenceCache(pc);
+
+  // the order of the batches in the state is not defined
+  auto first_page =
+      storage->getPendingTransactions("alice@iroha", 4, std::nullopt);
+  IROHA_ASSERT_RESULT_VALUE(first_page);
+  ASSERT_TRUE(first_page.assumeValue().next_batch_info);
+  auto cursor = first_page.assumeValue().next_batch_info->first_tx_hash;
+  auto second_batch_tx = first_page.assumeValue().transactions.back();
+
+  finalized_txs.get_subscriber().on_next(second_batch_tx->hash());
+
+  for (const auto &creator : {"alice@iroha", "bob@iroha"}) {
+    auto all = storage->getPendingTransactions(creator, 100, std::nullopt);
+    IROHA_ASSERT_RESULT_VALUE(all);
+    EXPECT_EQ(all.assumeValue().all_transactions_size, 4);
+
+    auto page = storage->getPendingTransactions(creator, 100, cursor);
+    IROHA_ASSERT_RESULT_VALUE(page);
+    ASSERT_EQ(page.assumeValue().transactions.size(), 2);
+    EXPECT_EQ(page.assumeValue().transactions.front()->hash(), cursor);
+  }
+}
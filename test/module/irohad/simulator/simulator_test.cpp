@@ -9,6 +9,7 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm/find.hpp>
+#include <boost/range/size.hpp>
 #include "backend/protobuf/proto_block_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "builders/protobuf/transaction.hpp"
@@ -179,6 +180,64 @@ TEST_F(SimulatorTest, ValidWhenPreviousBlock) {
   EXPECT_TRUE(block_wrapper.validate());
 }
 
+/**
+ * @given proposal with two transactions
+ * @when one of them is rejected by stateful validation
+ * @then the block speculatively created for the whole proposal is discarded
+ * @and the block of the verified proposal is created and signed
+ */
+TEST_F(SimulatorTest, SpeculativeBlockDiscardedOnRejectedTx) {
+  auto const now = iroha::time::now();
+  std::vector<shared_model::proto::Transaction> txs = {makeTx(now),
+                                                       makeTx(now + 1ull)};
+  std::shared_ptr<const shared_model::interface::Proposal> proposal =
+      std::make_shared<shared_model::proto::Proposal>(
+          shared_model::proto::ProposalBuilder()
+              .height(2)
+              .createdTime(now)
+              .transactions(txs)
+              .build());
+
+  auto validation_result =
+      std::make_unique<iroha::validation::VerifiedProposalAndErrors>();
+  validation_result->verified_proposal =
+      std::make_unique<shared_model::proto::Proposal>(
+          shared_model::proto::ProposalBuilder()
+              .height(2)
+              .createdTime(now)
+              .transactions(std::vector<shared_model::proto::Transaction>{
+                  txs.front()})
+              .build());
+  validation_result->rejected_transactions.emplace_back(
+      validation::TransactionError{
+          txs.back().hash(),
+          validation::CommandError{"SomeCommand", 1, "", true}});
+
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Invoke([&validation_result](const auto &p, auto &v) {
+        return std::move(validation_result);
+      }));
+  // the speculative block and the block of the verified proposal
+  EXPECT_CALL(*crypto_signer, sign(A<shared_model::interface::Block &>()))
+      .Times(2);
+
+  auto ledger_state = std::make_shared<LedgerState>(
+      ledger_peers, proposal->height() - 1, shared_model::crypto::Hash{"hash"});
+
+  auto block_wrapper = make_test_subscriber<CallExact>(simulator->onBlock(), 1);
+  block_wrapper.subscribe([&](auto event) {
+    auto block = getBlockUnsafe(event);
+    EXPECT_EQ(block->transactions(),
+              std::vector<shared_model::proto::Transaction>{txs.front()});
+    EXPECT_EQ(boost::size(block->rejected_transactions_hashes()), 1);
+  });
+
+  ordering_events.get_subscriber().on_next(
+      OrderingEvent{proposal, consensus::Round{}, ledger_state});
+
+  EXPECT_TRUE(block_wrapper.validate());
+}
+
 /**
  * Checks, that after failing a certain number of transactions in a proposal,
  * returned verified proposal will have only valid transactions
@@ -117,7 +117,7 @@ TEST_F(QueryProcessorTest, QueryProcessorWhereInvokeInvalidQuery) {
                  .finish();
   auto *qry_resp =
       query_response_factory
-          ->createAccountDetailResponse("", 1, std::nullopt, qry.hash())
+          ->createAccountDetailResponse("", 1, std::nullopt, qry.hash(), 0)
           .release();
 
   EXPECT_CALL(*qry_exec, validateAndExecute_(_)).WillOnce(Return(qry_resp));
@@ -151,7 +151,8 @@ TEST_F(QueryProcessorTest, QueryProcessorWithWrongKey) {
                                ErrorQueryType::kStatefulFailed,
                            "query signatories did not pass validation",
                            3,
-                           query.hash())
+                           query.hash(),
+                           0)
                        .release();
 
   EXPECT_CALL(*qry_exec, validateAndExecute_(_)).WillOnce(Return(qry_resp));
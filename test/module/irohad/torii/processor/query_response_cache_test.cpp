@@ -0,0 +1,200 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/processor/query_response_cache.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "datetime/time.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/query_responses/signatories_response.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_query_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+
+using namespace common_constants;
+using iroha::torii::QueryResponseCache;
+
+class QueryResponseCacheTest : public ::testing::Test {
+ public:
+  static constexpr shared_model::interface::types::HeightType kHeight = 10;
+
+  auto getSignatoriesQuery(
+      const std::string &account_id,
+      shared_model::interface::types::CounterType counter) {
+    return TestUnsignedQueryBuilder()
+        .createdTime(iroha::time::now())
+        .creatorAccountId(kAdminId)
+        .queryCounter(counter)
+        .getSignatories(account_id)
+        .build()
+        .signAndAddSignature(keypair)
+        .finish();
+  }
+
+  std::unique_ptr<shared_model::interface::QueryResponse> signatoriesResponse(
+      const shared_model::interface::Query &query,
+      shared_model::interface::types::HeightType height) {
+    return response_factory.createSignatoriesResponse(
+        {"signatory"}, query.hash(), height);
+  }
+
+  template <typename TxBuilder>
+  auto block(shared_model::interface::types::HeightType height,
+             const TxBuilder &tx) {
+    return TestBlockBuilder()
+        .height(height)
+        .transactions(std::vector<shared_model::proto::Transaction>{
+            tx.createdTime(iroha::time::now())
+                .creatorAccountId(kAdminId)
+                .quorum(1)
+                .build()})
+        .build();
+  }
+
+  /// Insert the response to the signatories query of the account
+  void cacheSignatories(const std::string &account_id) {
+    auto query = getSignatoriesQuery(account_id, 1);
+    cache.insert(*QueryResponseCache::makeKey(query),
+                 query,
+                 *signatoriesResponse(query, kHeight));
+  }
+
+  /// Find the response to the signatories query of the account
+  auto findSignatories(const std::string &account_id) {
+    auto query = getSignatoriesQuery(account_id, 2);
+    return cache.find(*QueryResponseCache::makeKey(query), query.hash());
+  }
+
+  shared_model::crypto::Keypair keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  shared_model::proto::ProtoQueryResponseFactory response_factory;
+  QueryResponseCache cache{kHeight, 100, getTestLogger("QueryResponseCache")};
+};
+
+/**
+ * @given a cached response to a query
+ * @when the same query is made again with another counter and time
+ * @then the cached response is returned with the hash of the new query
+ */
+TEST_F(QueryResponseCacheTest, FindsRepeatedQuery) {
+  cacheSignatories(kUserId);
+
+  auto query = getSignatoriesQuery(kUserId, 2);
+  auto response =
+      cache.find(*QueryResponseCache::makeKey(query), query.hash());
+  ASSERT_TRUE(response);
+  EXPECT_EQ(response->queryHash(), query.hash());
+  EXPECT_EQ(response->height(), kHeight);
+  EXPECT_NO_THROW(
+      boost::get<const shared_model::interface::SignatoriesResponse &>(
+          response->get()));
+  EXPECT_EQ(cache.hits(), 1);
+  EXPECT_EQ(cache.misses(), 0);
+}
+
+/**
+ * @given a response made at a height other than the current one
+ * @when it is inserted
+ * @then it is not cached
+ */
+TEST_F(QueryResponseCacheTest, SkipsResponseAtOtherHeight) {
+  auto query = getSignatoriesQuery(kUserId, 1);
+  cache.insert(*QueryResponseCache::makeKey(query),
+               query,
+               *signatoriesResponse(query, kHeight - 1));
+
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_FALSE(findSignatories(kUserId));
+  EXPECT_EQ(cache.misses(), 1);
+}
+
+/**
+ * @given cached responses about two accounts
+ * @when a block changing one of the accounts is committed
+ * @then only the response about the other account is kept, at the new height
+ */
+TEST_F(QueryResponseCacheTest, DropsChangedAccountsOnCommit) {
+  cacheSignatories(kUserId);
+  cacheSignatories(kSameDomainUserId);
+
+  cache.onCommit(block(
+      kHeight + 1,
+      TestTransactionBuilder().addSignatory(
+          kUserId,
+          shared_model::interface::types::PublicKeyHexStringView{
+              keypair.publicKey()})));
+
+  EXPECT_FALSE(findSignatories(kUserId));
+  auto response = findSignatories(kSameDomainUserId);
+  ASSERT_TRUE(response);
+  EXPECT_EQ(response->height(), kHeight + 1);
+}
+
+/**
+ * @given a cached response
+ * @when a block appending a role is committed
+ * @then the cache is cleared, since permissions of anyone may have changed
+ */
+TEST_F(QueryResponseCacheTest, ClearsOnPermissionChange) {
+  cacheSignatories(kSameDomainUserId);
+
+  cache.onCommit(
+      block(kHeight + 1, TestTransactionBuilder().appendRole(kUserId, kRole)));
+
+  EXPECT_EQ(cache.size(), 0);
+}
+
+/**
+ * @given a cached response
+ * @when a block which does not follow the current height is committed
+ * @then the cache is cleared
+ */
+TEST_F(QueryResponseCacheTest, ClearsOnHeightGap) {
+  cacheSignatories(kSameDomainUserId);
+
+  cache.onCommit(block(
+      kHeight + 2,
+      TestTransactionBuilder().addSignatory(
+          kUserId,
+          shared_model::interface::types::PublicKeyHexStringView{
+              keypair.publicKey()})));
+
+  EXPECT_EQ(cache.size(), 0);
+}
+
+/**
+ * @given a full cache of two responses, the older of which is found again
+ * @when a response to a third query is inserted
+ * @then the least recently used response is evicted for it
+ */
+TEST_F(QueryResponseCacheTest, EvictsLeastRecentlyUsed) {
+  QueryResponseCache small_cache{
+      kHeight, 2, getTestLogger("QueryResponseCache")};
+  auto insert = [&](const std::string &account_id) {
+    auto query = getSignatoriesQuery(account_id, 1);
+    small_cache.insert(*QueryResponseCache::makeKey(query),
+                       query,
+                       *signatoriesResponse(query, kHeight));
+  };
+  auto find = [&](const std::string &account_id) {
+    auto query = getSignatoriesQuery(account_id, 2);
+    return small_cache.find(*QueryResponseCache::makeKey(query),
+                            query.hash());
+  };
+
+  insert(kUserId);
+  insert(kSameDomainUserId);
+  ASSERT_TRUE(find(kUserId));
+  insert(kAdminId);
+
+  EXPECT_EQ(small_cache.size(), 2);
+  EXPECT_EQ(small_cache.evictions(), 1);
+  EXPECT_TRUE(find(kUserId));
+  EXPECT_TRUE(find(kAdminId));
+  EXPECT_FALSE(find(kSameDomainUserId));
+}
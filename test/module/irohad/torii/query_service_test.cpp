@@ -80,7 +80,7 @@ class QueryServiceTest : public ::testing::Test {
 
   std::unique_ptr<shared_model::interface::QueryResponse> getResponse() {
     return shared_model::proto::ProtoQueryResponseFactory()
-        .createAccountResponse("a", "ru", 2, "", {"user"}, query->hash());
+        .createAccountResponse("a", "ru", 2, "", {"user"}, query->hash(), 0);
   }
 
   std::shared_ptr<shared_model::proto::Query> query;
@@ -222,8 +222,11 @@ TEST_F(ToriiQueriesTest, FindAccountWhenNoGrantPermissions) {
                          .finish();
 
   auto *r = query_response_factory
-                ->createErrorQueryResponse(
-                    ErrorQueryType::kStatefulFailed, "", 2, model_query.hash())
+                ->createErrorQueryResponse(ErrorQueryType::kStatefulFailed,
+                                           "",
+                                           2,
+                                           model_query.hash(),
+                                           0)
                 .release();
 
   EXPECT_CALL(*query_executor, validateAndExecute_(_))
@@ -270,8 +273,13 @@ TEST_F(ToriiQueriesTest, FindAccountWhenHasReadPermissions) {
                          .finish();
 
   auto *r = query_response_factory
-                ->createAccountResponse(
-                    accountB_id, domainB_id, 1, {}, roles, model_query.hash())
+                ->createAccountResponse(accountB_id,
+                                        domainB_id,
+                                        1,
+                                        {},
+                                        roles,
+                                        model_query.hash(),
+                                        0)
                 .release();
 
   EXPECT_CALL(*query_executor, validateAndExecute_(_))
@@ -319,8 +327,13 @@ TEST_F(ToriiQueriesTest, FindAccountWhenHasRolePermission) {
                          .finish();
 
   auto *r = query_response_factory
-                ->createAccountResponse(
-                    account_id, domain_id, 1, "{}", roles, model_query.hash())
+                ->createAccountResponse(account_id,
+                                        domain_id,
+                                        1,
+                                        "{}",
+                                        roles,
+                                        model_query.hash(),
+                                        0)
                 .release();
 
   EXPECT_CALL(*query_executor, validateAndExecute_(_))
@@ -371,8 +384,11 @@ TEST_F(ToriiQueriesTest, FindAccountAssetWhenNoGrantPermissions) {
           .finish();
 
   auto *r = query_response_factory
-                ->createErrorQueryResponse(
-                    ErrorQueryType::kStatefulFailed, "", 2, model_query.hash())
+                ->createErrorQueryResponse(ErrorQueryType::kStatefulFailed,
+                                           "",
+                                           2,
+                                           model_query.hash(),
+                                           0)
                 .release();
 
   EXPECT_CALL(*query_executor, validateAndExecute_(_))
@@ -421,8 +437,11 @@ TEST_F(ToriiQueriesTest, FindAccountAssetWhenHasRolePermissions) {
       assets;
   assets.push_back(std::make_tuple(account_id, asset_id, amount));
   auto *r = query_response_factory
-                ->createAccountAssetResponse(
-                    assets, assets.size(), std::nullopt, model_query.hash())
+                ->createAccountAssetResponse(assets,
+                                             assets.size(),
+                                             std::nullopt,
+                                             model_query.hash(),
+                                             0)
                 .release();
 
   EXPECT_CALL(*query_executor, validateAndExecute_(_))
@@ -474,8 +493,11 @@ TEST_F(ToriiQueriesTest, FindSignatoriesWhenNoGrantPermissions) {
                          .finish();
 
   auto *r = query_response_factory
-                ->createErrorQueryResponse(
-                    ErrorQueryType::kStatefulFailed, "", 2, model_query.hash())
+                ->createErrorQueryResponse(ErrorQueryType::kStatefulFailed,
+                                           "",
+                                           2,
+                                           model_query.hash(),
+                                           0)
                 .release();
 
   EXPECT_CALL(*query_executor, validateAndExecute_(_))
@@ -516,7 +538,7 @@ TEST_F(ToriiQueriesTest, FindSignatoriesHasRolePermissions) {
                          .finish();
 
   auto *r = query_response_factory
-                ->createSignatoriesResponse(signatories, model_query.hash())
+                ->createSignatoriesResponse(signatories, model_query.hash(), 0)
                 .release();
 
   EXPECT_CALL(*query_executor, validateAndExecute_(_))
@@ -585,7 +607,8 @@ TEST_F(ToriiQueriesTest, FindTransactionsWhenValid) {
 
   auto *r = query_response_factory
                 ->createTransactionsResponse(std::move(response_txs),
-                                             model_query.hash())
+                                             model_query.hash(),
+                                             0)
                 .release();
 
   EXPECT_CALL(*query_executor, validateAndExecute_(_))
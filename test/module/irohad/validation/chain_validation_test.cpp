@@ -5,6 +5,10 @@
 
 #include "validation/impl/chain_validator_impl.hpp"
 
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
 #include <boost/range/adaptor/indirected.hpp>
 #include "framework/test_logger.hpp"
 #include "module/irohad/ametsuchi/mock_mutable_storage.hpp"
@@ -19,6 +23,7 @@ using ::testing::_;
 using ::testing::A;
 using ::testing::ByRef;
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::InvokeArgument;
 using ::testing::Pointee;
 using ::testing::Return;
@@ -29,7 +34,7 @@ class ChainValidationTest : public ::testing::Test {
  public:
   void SetUp() override {
     validator = std::make_shared<ChainValidatorImpl>(
-        supermajority_checker, getTestLogger("ChainValidator"));
+        supermajority_checker, block_cache, getTestLogger("ChainValidator"));
     storage = std::make_shared<MockMutableStorage>();
     peers = std::vector<std::shared_ptr<shared_model::interface::Peer>>();
 
@@ -60,6 +65,8 @@ class ChainValidationTest : public ::testing::Test {
   std::shared_ptr<iroha::consensus::yac::MockSupermajorityChecker>
       supermajority_checker =
           std::make_shared<iroha::consensus::yac::MockSupermajorityChecker>();
+  std::shared_ptr<consensus::ConsensusResultCache> block_cache =
+      std::make_shared<consensus::ConsensusResultCache>();
   std::shared_ptr<ChainValidatorImpl> validator;
   std::shared_ptr<MockMutableStorage> storage;
 
@@ -86,7 +93,7 @@ TEST_F(ChainValidationTest, ValidCase) {
   EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
       .WillOnce(DoAll(SaveArg<0>(&block_signatures_amount), Return(true)));
 
-  EXPECT_CALL(*storage, apply(blocks, _))
+  EXPECT_CALL(*storage, apply(_, _))
       .WillOnce(
           InvokeArgument<1>(block, LedgerState{peers, prev_height, prev_hash}));
 
@@ -107,7 +114,7 @@ TEST_F(ChainValidationTest, FailWhenDifferentPrevHash) {
   EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
       .WillRepeatedly(Return(true));
 
-  EXPECT_CALL(*storage, apply(blocks, _))
+  EXPECT_CALL(*storage, apply(_, _))
       .WillOnce(InvokeArgument<1>(
           block, LedgerState{peers, prev_height, another_hash}));
 
@@ -125,10 +132,114 @@ TEST_F(ChainValidationTest, FailWhenNoSupermajority) {
   EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
       .WillOnce(DoAll(SaveArg<0>(&block_signatures_amount), Return(false)));
 
-  EXPECT_CALL(*storage, apply(blocks, _))
+  EXPECT_CALL(*storage, apply(_, _))
       .WillOnce(
           InvokeArgument<1>(block, LedgerState{peers, prev_height, prev_hash}));
 
   ASSERT_FALSE(validator->validateAndApply(blocks, *storage));
   ASSERT_EQ(boost::size(block->signatures()), block_signatures_amount);
 }
+
+/**
+ * @given block with the same hash as the consensus result in cache
+ * @when the chain with the block is applied
+ * @then the block from cache is applied instead of the received one
+ */
+TEST_F(ChainValidationTest, BlockTakenFromConsensusCache) {
+  auto cached_block = std::make_shared<MockBlock>();
+  EXPECT_CALL(*cached_block, height()).WillRepeatedly(Return(height));
+  EXPECT_CALL(*cached_block, prevHash())
+      .WillRepeatedly(testing::ReturnRef(prev_hash));
+  EXPECT_CALL(*cached_block, signatures())
+      .WillRepeatedly(Return(signatures | boost::adaptors::indirected));
+  EXPECT_CALL(*cached_block, hash())
+      .WillRepeatedly(
+          testing::ReturnRefOfCopy(shared_model::crypto::Hash("hash")));
+  block_cache->insert(cached_block);
+
+  EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
+      .WillOnce(Return(true));
+
+  std::shared_ptr<const shared_model::interface::Block> applied_block;
+  EXPECT_CALL(*storage, apply(_, _))
+      .WillOnce(Invoke([&](auto chain, auto predicate) {
+        return chain
+            .all([&](auto block) {
+              applied_block = block;
+              return predicate(block,
+                               LedgerState{peers, prev_height, prev_hash});
+            })
+            .as_blocking()
+            .first();
+      }));
+
+  ASSERT_TRUE(validator->validateAndApply(blocks, *storage));
+  ASSERT_EQ(cached_block, applied_block);
+}
+
+/**
+ * @given block stream which fails after the block
+ * @when the chain is applied
+ * @then the error of the stream is rethrown after the block is applied
+ */
+TEST_F(ChainValidationTest, StreamErrorIsPropagated) {
+  EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
+      .WillOnce(Return(true));
+
+  size_t applied_blocks = 0;
+  EXPECT_CALL(*storage, apply(_, _))
+      .WillOnce(Invoke([&](auto chain, auto predicate) {
+        return chain
+            .all([&](auto block) {
+              ++applied_blocks;
+              return predicate(block,
+                               LedgerState{peers, prev_height, prev_hash});
+            })
+            .as_blocking()
+            .first();
+      }));
+
+  auto failing_blocks =
+      rxcpp::observable<>::create<
+          std::shared_ptr<shared_model::interface::Block>>(
+          [this](auto subscriber) {
+            subscriber.on_next(block);
+            subscriber.on_error(std::make_exception_ptr(
+                std::runtime_error("connection lost")));
+          });
+  ASSERT_THROW(validator->validateAndApply(failing_blocks, *storage),
+               std::runtime_error);
+  ASSERT_EQ(applied_blocks, 1);
+}
+
+/**
+ * @given block stream which does not complete after the block
+ * @when the block is not valid
+ * @then validation finishes without waiting for the end of the stream
+ */
+TEST_F(ChainValidationTest, InvalidBlockStopsStream) {
+  EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
+      .WillRepeatedly(Return(true));
+
+  EXPECT_CALL(*storage, apply(_, _))
+      .WillOnce(Invoke([&](auto chain, auto predicate) {
+        return chain
+            .all([&](auto block) {
+              return predicate(block,
+                               LedgerState{peers, prev_height, block->hash()});
+            })
+            .as_blocking()
+            .first();
+      }));
+
+  auto endless_blocks =
+      rxcpp::observable<>::create<
+          std::shared_ptr<shared_model::interface::Block>>(
+          [this](auto subscriber) {
+            subscriber.on_next(block);
+            while (subscriber.is_subscribed()) {
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+          });
+  ASSERT_FALSE(validator->validateAndApply(endless_blocks, *storage));
+}
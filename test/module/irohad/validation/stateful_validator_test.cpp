@@ -5,6 +5,7 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <boost/range/adaptor/transformed.hpp>
 #include <gtest/gtest.h>
 #include "backend/protobuf/proto_proposal_factory.hpp"
 #include "common/result.hpp"
@@ -28,6 +29,7 @@ using ::testing::A;
 using ::testing::ByMove;
 using ::testing::ByRef;
 using ::testing::Eq;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnArg;
 
@@ -351,3 +353,55 @@ TEST_F(Validator, Batches) {
   EXPECT_EQ(verified_proposal_and_errors->rejected_transactions[1].tx_hash,
             txs[4].hash());
 }
+
+/**
+ * @given transactions of three creators, the first of which adds a signatory
+ * to the creator of the second one
+ * @when statefully validating these transactions
+ * @then signatures of the first and the third transactions are checked in
+ * advance @and signatures of the second one are left to its application
+ */
+TEST_F(Validator, SignaturesPrevalidatedForIndependentTxs) {
+  const std::string public_key(64, '0');
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("alice@test")
+                    .createdTime(iroha::time::now())
+                    .quorum(1)
+                    .addSignatory("bob@test",
+                                  makePublicKeyHexStringView(public_key))
+                    .build());
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("bob@test")
+                    .createdTime(iroha::time::now())
+                    .quorum(1)
+                    .createAsset("doge", "coin", 1)
+                    .build());
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("carol@test")
+                    .createdTime(iroha::time::now())
+                    .quorum(1)
+                    .createAsset("doge", "coin", 1)
+                    .build());
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(3)
+                      .transactions(txs)
+                      .build();
+
+  std::vector<shared_model::interface::types::HashType> prevalidated;
+  EXPECT_CALL(*temp_wsv_mock, prevalidateSignatures(_))
+      .WillOnce(Invoke([&prevalidated](const auto &transactions) {
+        for (const auto &tx : transactions) {
+          prevalidated.push_back(tx.get().hash());
+        }
+      }));
+  EXPECT_CALL(*temp_wsv_mock, apply(_))
+      .WillRepeatedly(Return(iroha::expected::Value<void>({})));
+
+  sfv->validate(proposal, *temp_wsv_mock);
+
+  ASSERT_EQ(prevalidated.size(), 2);
+  EXPECT_EQ(prevalidated[0], txs[0].hash());
+  EXPECT_EQ(prevalidated[1], txs[2].hash());
+}
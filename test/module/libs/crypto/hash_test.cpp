@@ -139,3 +139,36 @@ TEST(Hash, sha3_512_RU_text_LOOP) {
                  res.c_str());
   }
 }
+
+/**
+ * @given inputs of sizes around the SHA3-256 block size, in a number which is
+ * not a multiple of the number of SIMD lanes
+ * @when they are hashed at once
+ * @then each hash is the same as the hash of the input alone
+ */
+TEST(Hash, sha3_256_several_inputs) {
+  std::vector<std::vector<uint8_t>> inputs;
+  for (size_t size : {0, 1, 31, 135, 136, 137, 271, 272, 500, 64, 3}) {
+    std::vector<uint8_t> input(size);
+    for (size_t i = 0; i < size; ++i) {
+      input[i] = static_cast<uint8_t>(i * 7 + size);
+    }
+    inputs.push_back(std::move(input));
+  }
+
+  std::vector<iroha::hash256_t> hashes(inputs.size());
+  std::vector<uint8_t *> outputs;
+  std::vector<const uint8_t *> data;
+  std::vector<size_t> sizes;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    outputs.push_back(hashes[i].data());
+    data.push_back(inputs[i].data());
+    sizes.push_back(inputs[i].size());
+  }
+  sha3_256(outputs.data(), data.data(), sizes.data(), inputs.size());
+
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    EXPECT_EQ(hashes[i].to_hexstring(), sha3_256(inputs[i]).to_hexstring())
+        << "input of size " << inputs[i].size();
+  }
+}
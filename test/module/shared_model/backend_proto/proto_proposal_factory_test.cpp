@@ -73,3 +73,30 @@ TEST_F(ProposalFactoryTest, InvalidProposalTest) {
   proposal.match([&](const auto &) { FAIL() << "unexpected value case"; },
                  [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given proposal created by the factory on an arena
+ * @when the transactions it was made of are destroyed
+ * @then the proposal keeps its transactions and is the same as the proposal
+ * of a heap allocated transport
+ */
+TEST_F(ProposalFactoryTest, ArenaProposalOutlivesTransactions) {
+  iroha::protocol::Transaction proto_tx;
+  proto_tx.mutable_payload()->mutable_reduced_payload()->set_creator_account_id(
+      "admin@test");
+  std::vector<proto::Transaction> source_txs;
+  source_txs.emplace_back(proto_tx);
+  auto proposal = valid_factory.unsafeCreateProposal(height, time, source_txs);
+  source_txs.clear();
+
+  iroha::protocol::Proposal heap_transport;
+  heap_transport.set_height(height);
+  heap_transport.set_created_time(time);
+  *heap_transport.add_transactions() = proto_tx;
+  proto::Proposal heap_proposal(std::move(heap_transport));
+
+  ASSERT_EQ(proposal->transactions().size(), 1);
+  EXPECT_EQ(proposal->transactions().front().creatorAccountId(), "admin@test");
+  EXPECT_EQ(proposal->blob(), heap_proposal.blob());
+  EXPECT_EQ(proposal->hash(), heap_proposal.hash());
+}
@@ -95,7 +95,7 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateAccountAssetResponse) {
   }
 
   query_responses.push_back(response_factory->createAccountAssetResponse(
-      assets, assets.size(), std::nullopt, kQueryHash));
+      assets, assets.size(), std::nullopt, kQueryHash, 0));
 
   for (auto &query_response : query_responses) {
     ASSERT_TRUE(query_response);
@@ -128,7 +128,7 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateAccountDetailResponse) {
   const shared_model::plain::AccountDetailRecordId next_record_id{"pepe@uganda",
                                                                   "fav_chan"};
   auto query_response = response_factory->createAccountDetailResponse(
-      account_details, total_number, next_record_id, kQueryHash);
+      account_details, total_number, next_record_id, kQueryHash, 0);
 
   ASSERT_TRUE(query_response);
   ASSERT_EQ(query_response->queryHash(), kQueryHash);
@@ -163,7 +163,7 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateAccountResponse) {
       query_responses;
 
   query_responses.push_back(response_factory->createAccountResponse(
-      kAccountId, kDomainId, kQuorum, kJson, kRoles, kQueryHash));
+      kAccountId, kDomainId, kQuorum, kJson, kRoles, kQueryHash, 0));
 
   for (auto &query_response : query_responses) {
     ASSERT_TRUE(query_response);
@@ -198,11 +198,11 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateErrorQueryResponse) {
   const auto kNoSigsErrorMsg = "no signatories";
 
   auto stateless_invalid_response = response_factory->createErrorQueryResponse(
-      ErrorTypes::kStatelessFailed, kStatelessErrorMsg, 0, kQueryHash);
+      ErrorTypes::kStatelessFailed, kStatelessErrorMsg, 0, kQueryHash, 0);
   auto stateful_failed_response = response_factory->createErrorQueryResponse(
-      ErrorTypes::kStatefulFailed, kStatefulFailedErrorMsg, 1, kQueryHash);
+      ErrorTypes::kStatefulFailed, kStatefulFailedErrorMsg, 1, kQueryHash, 0);
   auto no_signatories_response = response_factory->createErrorQueryResponse(
-      ErrorTypes::kNoSignatories, kNoSigsErrorMsg, 0, kQueryHash);
+      ErrorTypes::kNoSignatories, kNoSigsErrorMsg, 0, kQueryHash, 0);
 
   ASSERT_TRUE(stateless_invalid_response);
   ASSERT_EQ(stateless_invalid_response->queryHash(), kQueryHash);
@@ -251,20 +251,22 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateErrorQueryResponse) {
  * Checks createSignatoriesResponse method of QueryResponseFactory
  * @given signatories
  * @when creating signatories query response via factory
- * @then that response is created @and is well-formed
+ * @then that response is created @and is well-formed @and has the given height
  */
 TEST_F(ProtoQueryResponseFactoryTest, CreateSignatoriesResponse) {
   const HashType kQueryHash{"my_super_hash"};
+  const HeightType kHeight{42};
 
   std::vector<std::string> signatories;
   signatories.emplace_back(
       shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair()
           .publicKey());
-  auto query_response =
-      response_factory->createSignatoriesResponse(signatories, kQueryHash);
+  auto query_response = response_factory->createSignatoriesResponse(
+      signatories, kQueryHash, kHeight);
 
   ASSERT_TRUE(query_response);
   ASSERT_EQ(query_response->queryHash(), kQueryHash);
+  ASSERT_EQ(query_response->height(), kHeight);
   ASSERT_NO_THROW({
     const auto &response =
         boost::get<const shared_model::interface::SignatoriesResponse &>(
@@ -296,7 +298,7 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateTransactionsResponse) {
     transactions_test_copy.push_back(std::move(tx_copy));
   }
   auto query_response = response_factory->createTransactionsResponse(
-      std::move(transactions), kQueryHash);
+      std::move(transactions), kQueryHash, 0);
 
   ASSERT_TRUE(query_response);
   ASSERT_EQ(query_response->queryHash(), kQueryHash);
@@ -335,7 +337,7 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateTransactionsPageResponse) {
     transactions_test_copy.push_back(std::move(tx_copy));
   }
   auto query_response = response_factory->createTransactionsPageResponse(
-      std::move(transactions), kNextTxHash, kTransactionsNumber, kQueryHash);
+      std::move(transactions), kNextTxHash, kTransactionsNumber, kQueryHash, 0);
 
   ASSERT_TRUE(query_response);
   EXPECT_EQ(query_response->queryHash(), kQueryHash);
@@ -377,7 +379,11 @@ TEST_F(ProtoQueryResponseFactoryTest,
     transactions_test_copy.push_back(std::move(tx_copy));
   }
   auto query_response = response_factory->createTransactionsPageResponse(
-      std::move(transactions), std::nullopt, kTransactionsNumber, kQueryHash);
+      std::move(transactions),
+      std::nullopt,
+      kTransactionsNumber,
+      kQueryHash,
+      0);
 
   ASSERT_TRUE(query_response);
   EXPECT_EQ(query_response->queryHash(), kQueryHash);
@@ -411,7 +417,7 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateAssetResponse) {
   std::vector<std::unique_ptr<shared_model::interface::QueryResponse>>
       query_responses;
   query_responses.push_back(response_factory->createAssetResponse(
-      kAssetId, kDomainId, kPrecision, kQueryHash));
+      kAssetId, kDomainId, kPrecision, kQueryHash, 0));
 
   for (auto &query_response : query_responses) {
     ASSERT_TRUE(query_response);
@@ -439,7 +445,7 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateRolesResponse) {
 
   const std::vector<RoleIdType> roles{"admin", "user"};
   auto query_response =
-      response_factory->createRolesResponse(roles, kQueryHash);
+      response_factory->createRolesResponse(roles, kQueryHash, 0);
 
   ASSERT_TRUE(query_response);
   ASSERT_EQ(query_response->queryHash(), kQueryHash);
@@ -465,7 +471,7 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateRolePermissionsResponse) {
       shared_model::interface::permissions::Role::kGetMyAccount,
       shared_model::interface::permissions::Role::kAddSignatory};
   auto query_response =
-      response_factory->createRolePermissionsResponse(perms, kQueryHash);
+      response_factory->createRolePermissionsResponse(perms, kQueryHash, 0);
 
   ASSERT_TRUE(query_response);
   ASSERT_EQ(query_response->queryHash(), kQueryHash);
@@ -6,6 +6,8 @@
 #include "cryptography/blob.hpp"
 #include <gtest/gtest.h>
 #include <memory>
+#include <thread>
+#include <vector>
 
 using namespace shared_model::crypto;
 using namespace std::literals::string_literals;
@@ -43,3 +45,65 @@ TEST_F(BlobMock, BlobIsString) {
     ASSERT_EQ(binary[i], bin_str[i]);
   }
 }
+
+/**
+ * @given blob with hex representation made
+ * @when another blob is assigned to it
+ * @then hex representation is of the assigned blob
+ */
+TEST_F(BlobMock, HexAfterAssignment) {
+  ASSERT_EQ("48656c6c6f2000576f726c64", blob->hex());
+  Blob other("ab");
+  *blob = other;
+  ASSERT_EQ("6162", blob->hex());
+  *blob = Blob("c");
+  ASSERT_EQ("63", blob->hex());
+}
+
+/**
+ * @given blob with hex representation made
+ * @when the blob is copied and moved
+ * @then hex representations of the copy and of the moved blob are the same
+ * @and the moved from blob is empty
+ */
+TEST_F(BlobMock, HexAfterCopyAndMove) {
+  const auto hex = blob->hex();
+  Blob copy(*blob);
+  Blob moved(std::move(*blob));
+  ASSERT_EQ(hex, copy.hex());
+  ASSERT_EQ(hex, moved.hex());
+  ASSERT_EQ("", blob->hex());
+}
+
+/**
+ * @given blob with hex representation made
+ * @when the blob is moved to itself
+ * @then its data and hex representation are kept
+ */
+TEST_F(BlobMock, SelfMove) {
+  const auto hex = blob->hex();
+  auto &self = *blob;
+  *blob = std::move(self);
+  ASSERT_EQ(toBinaryString(*blob), data);
+  ASSERT_EQ(hex, blob->hex());
+}
+
+/**
+ * @given blob without hex representation
+ * @when hex representation is requested by several threads at once
+ * @then all of them get the same string
+ */
+TEST_F(BlobMock, ConcurrentHex) {
+  std::vector<std::thread> threads;
+  std::vector<const std::string *> hexes(8);
+  for (size_t i = 0; i < hexes.size(); ++i) {
+    threads.emplace_back([this, &hexes, i] { hexes[i] = &blob->hex(); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (const auto hex : hexes) {
+    ASSERT_EQ(hex, hexes.front());
+  }
+  ASSERT_EQ("48656c6c6f2000576f726c64", *hexes.front());
+}